@@ -135,16 +135,15 @@ TimedColorSource::TimedColorSource(const String& name, var params) :
 
 	offsetByID = sourceParams.addFloatParameter("Time Offset By ID", "Time Offset by object ID", 0);
 
-	timeAtLastUpdate = Time::getMillisecondCounterHiRes() / 1000.0;
+	timeAtLastUpdate = EngineClock::getInstance()->tickTime;
 	curTime = 0;
-	
-	TimedEffectHiResTimer::getInstance()->addTimerListener(this);
+
+	EngineClock::getInstance()->addClockListener(this);
 }
 
 TimedColorSource::~TimedColorSource()
 {
-	if(TimedEffectHiResTimer::getInstanceWithoutCreating() != nullptr) TimedEffectHiResTimer::getInstance()->removeTimerListener(this);
-
+	if (EngineClock::getInstanceWithoutCreating() != nullptr) EngineClock::getInstance()->removeClockListener(this);
 }
 
 void TimedColorSource::linkToTemplate(ColorSource* st)
@@ -155,14 +154,18 @@ void TimedColorSource::linkToTemplate(ColorSource* st)
 	{
 		speed->hideInEditor = false;
 		speed->setControllableFeedbackOnly(false);
-		if (TimedEffectHiResTimer::getInstanceWithoutCreating() != nullptr) TimedEffectHiResTimer::getInstance()->addTimerListener(this);
+		if (EngineClock::getInstanceWithoutCreating() != nullptr)
+		{
+			timeAtLastUpdate = EngineClock::getInstance()->tickTime;
+			EngineClock::getInstance()->addClockListener(this);
+		}
 	}
 	else
 	{
 		speed->hideInEditor = true;
 		speed->setControllableFeedbackOnly(true);
 		speed->resetValue();
-		if (TimedEffectHiResTimer::getInstanceWithoutCreating() != nullptr) TimedEffectHiResTimer::getInstance()->removeTimerListener(this);
+		if (EngineClock::getInstanceWithoutCreating() != nullptr) EngineClock::getInstance()->removeClockListener(this);
 	}
 }
 
@@ -180,14 +183,19 @@ float TimedColorSource::getCurrentTime(float timeOverride)
 	return timeOverride >= 0 ? timeOverride * speed->floatValue() : curTime;
 }
 
-void TimedColorSource::hiResTimerCallback()
+void TimedColorSource::clockTicked()
 {
 	addTime();
 }
 
+void TimedColorSource::clockReset()
+{
+	timeAtLastUpdate = EngineClock::getInstance()->tickTime;
+}
+
 void TimedColorSource::addTime()
 {
-	double newTime = Time::getMillisecondCounter() / 1000.0;
+	double newTime = EngineClock::getInstance()->tickTime;
 	curTime += (newTime - timeAtLastUpdate) * speed->floatValue();
 	timeAtLastUpdate = newTime;
 }
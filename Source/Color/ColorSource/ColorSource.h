@@ -72,7 +72,7 @@ public:
 
 class TimedColorSource :
 	public ColorSource,
-	public TimedEffectHiResTimer::TimerListener
+	public EngineClock::ClockListener
 {
 public:
 	TimedColorSource(const String& name, var params = var());
@@ -95,7 +95,8 @@ public:
 
 	virtual void addTime();
 
-	virtual void hiResTimerCallback() override;
+	virtual void clockTicked() override;
+	virtual void clockReset() override;
 
 };
 
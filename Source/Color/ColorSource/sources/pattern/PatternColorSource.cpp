@@ -46,10 +46,15 @@ RainbowColorSource::~RainbowColorSource()
 void RainbowColorSource::fillColorsForObjectTimeInternal(Array<Colour, CriticalSection>& colors, Object* o, ColorComponent* comp, int id, float time, float originalTime)
 {
 	int resolution = colors.size();
+
+	const double densityVal = GetSourceLinkedValue(density);
+	const float saturationVal = GetSourceLinkedValue(saturation);
+	const float brightnessVal = GetSourceLinkedValue(brightness);
+
 	for (int i = 0; i < resolution; i++)
 	{
-		double rel = fmodf((1 - (i * 1.0f / resolution)) * (double)GetSourceLinkedValue(density) + time, 1);
-		colors.set(i, Colour::fromHSV(rel, (double)GetSourceLinkedValue(saturation), (double)GetSourceLinkedValue(brightness), 1));
+		double rel = fmodf((1 - (i * 1.0f / resolution)) * densityVal + time, 1);
+		colors.set(i, Colour::fromHSV(rel, saturationVal, brightnessVal, 1));
 	}
 }
 
@@ -84,8 +89,8 @@ NoiseColorSource::NoiseColorSource(var params) :
 	balance = sourceParams.addFloatParameter("Balance", "The balance between colors", 0, -1, 1);
 	contrast = sourceParams.addFloatParameter("Contrast", "", 3);
 	scale = sourceParams.addFloatParameter("Scale", "", 3);
-
-	perlin.reset(new siv::PerlinNoise());
+	octaves = sourceParams.addIntParameter("Octaves", "Number of fractal layers of noise, more octaves add finer details", 1, 1, 8);
+	spatial = sourceParams.addBoolParameter("Spatial", "If checked, the noise is sampled from the stage position of each pixel instead of its index, so neighbour objects get coherent noise", false);
 }
 
 NoiseColorSource::~NoiseColorSource()
@@ -97,11 +102,39 @@ void NoiseColorSource::fillColorsForObjectTimeInternal(Array<Colour, CriticalSec
 	Colour bColor = GetLinkedColor(bgColor);
 	Colour fColor = GetLinkedColor(frontColor);
 
+	const double scaleVal = GetSourceLinkedValue(scale);
+	const double contrastVal = GetSourceLinkedValue(contrast);
+	const double balanceVal = GetSourceLinkedValue(balance);
+	const float brightnessVal = GetSourceLinkedValue(brightness);
+	const bool spatialVal = GetSourceLinkedValue(spatial);
+
+	NoiseHelpers::NoiseSettings settings;
+	settings.octaves = GetSourceLinkedValue(octaves);
+
 	int resolution = colors.size();
+	noiseBuffer.resize(resolution);
+
+	if (spatialVal && comp->pixelShape != nullptr)
+	{
+		PixelShape::PositionTable::Ptr table = comp->pixelShape->getPositionTable();
+		const Array<Vector3D<float>>& shapePositions = table->positions;
+		positionBuffer.resize(resolution);
+		Vector3D<float> objectPos = o->stagePosition->getVector();
+		for (int i = 0; i < resolution; i++) positionBuffer.set(i, (objectPos + shapePositions[i]) * (float)scaleVal);
+		NoiseHelpers::fill3D(settings, positionBuffer.getRawDataPointer(), noiseBuffer.getRawDataPointer(), resolution, Vector3D<float>(0, 0, time));
+	}
+	else
+	{
+		xBuffer.resize(resolution);
+		for (int i = 0; i < resolution; i++) xBuffer.set(i, (i * scaleVal) / resolution);
+		NoiseHelpers::fill2D(settings, xBuffer.getRawDataPointer(), time, noiseBuffer.getRawDataPointer(), resolution);
+	}
+
+	const float* noise = noiseBuffer.getRawDataPointer();
 	for (int i = 0; i < resolution; i++)
 	{
-		double v = (perlin->noise0_1((i * (double)GetSourceLinkedValue(scale)) / resolution, time) - .5f) * (double)GetSourceLinkedValue(contrast) + .5f + (double)GetSourceLinkedValue(balance) * 2;
-		colors.set(i, bColor.interpolatedWith(fColor, v).withMultipliedBrightness((double)GetSourceLinkedValue(brightness)));
+		double v = noise[i] * .5f * contrastVal + .5f + balanceVal * 2;
+		colors.set(i, bColor.interpolatedWith(fColor, v).withMultipliedBrightness(brightnessVal));
 	}
 }
 
@@ -143,15 +176,18 @@ void PointColorSource::fillColorsForObjectInternal(Array<Colour, CriticalSection
 	double relEnd = jmin<int>(relPos + (sizeVal * resolution / 2.f), resolution);
 	double relSize = sizeVal * resolution * extendVal;
 
+	const double fadeVal = GetSourceLinkedValue(fade);
+	const bool invert = id % 2 == 0 ? GetSourceLinkedValue(invertEvens) : GetSourceLinkedValue(invertOdds);
+	const float brightnessVal = GetSourceLinkedValue(brightness);
+
 	colors.fill(bColor);
 
 	for (int i = relStart; i <= relEnd && i < resolution; i++)
 	{
-		double diff = 1 - (fabsf(i - relPos) * 1.f / (relSize / ((double)GetSourceLinkedValue(fade) * 2 * extendVal)));
+		double diff = 1 - (fabsf(i - relPos) * 1.f / (relSize / (fadeVal * 2 * extendVal)));
 
-		bool invert = id % 2 == 0 ? GetSourceLinkedValue(invertEvens) : GetSourceLinkedValue(invertOdds);
 		Colour c = bColor.interpolatedWith(pColor, diff);
-		colors.set(invert ? resolution - i : i, c.withMultipliedBrightness((double)GetSourceLinkedValue(brightness)));
+		colors.set(invert ? resolution - i : i, c.withMultipliedBrightness(brightnessVal));
 	}
 }
 
@@ -188,18 +224,22 @@ void MultiPointColorSource::fillColorsForObjectTimeInternal(Array<Colour, Critic
 	double targetPos = time;
 	if (targetPos < 0) targetPos = fmodf(targetPos, -gapVal) + gapVal;
 
+	const double sizeVal = GetSourceLinkedValue(size);
+	const double fadeVal = GetSourceLinkedValue(fade);
+	const float brightnessVal = GetSourceLinkedValue(brightness);
+
 	for (int i = 0; i < resolution; i++)
 	{
 		double relTotal = fmodf((1 - (i * 1.0f / resolution)), 1);
 		double relGap = fmodf((relTotal + gapVal + targetPos) / gapVal, 1);
-		double relCentered = 1 - fabsf((relGap - .5f) * 2) * 1 / (double)GetSourceLinkedValue(size);
+		double relCentered = 1 - fabsf((relGap - .5f) * 2) * 1 / sizeVal;
 
 		if (relCentered < 0) continue;
 
-		double relFadedVal = jmap<double>(jlimit<double>(0, 1, relCentered), 1 - (double)GetSourceLinkedValue(fade), 1);
+		double relFadedVal = jmap<double>(jlimit<double>(0, 1, relCentered), 1 - fadeVal, 1);
 
 		Colour c = bColor.interpolatedWith(pColor, relFadedVal);
-		colors.set(i, c.withMultipliedBrightness((double)GetSourceLinkedValue(brightness)));
+		colors.set(i, c.withMultipliedBrightness(brightnessVal));
 	}
 }
 
@@ -244,11 +284,14 @@ void GradientColorSource::fillColorsForObjectTimeInternal(Array<Colour, Critical
 {
 	const int resolution = colors.size();
 
+	const double densityVal = GetSourceLinkedValue(density);
+	const float brightnessVal = GetSourceLinkedValue(brightness);
+
 	for (int i = 0; i < resolution; i++)
 	{
-		double p = fmodf(time + i * (double)GetSourceLinkedValue(density) / resolution, 1);
+		double p = fmodf(time + i * densityVal / resolution, 1);
 		if (p < 0) p++;
-		colors.set(i, gradientTarget->getColorForPosition(p).withMultipliedBrightness((double)GetSourceLinkedValue(brightness)));
+		colors.set(i, gradientTarget->getColorForPosition(p).withMultipliedBrightness(brightnessVal));
 	}
 }
 
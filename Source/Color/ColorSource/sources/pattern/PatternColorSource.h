@@ -64,11 +64,6 @@ public:
     static StrobeColorSource* create(var params) { return new StrobeColorSource(params); }
 };
 
-namespace siv
-{
-    class PerlinNoise;
-}
-
 class NoiseColorSource :
     public TimedColorSource
 {
@@ -76,15 +71,19 @@ public:
     NoiseColorSource(var params = var());
     ~NoiseColorSource();
 
-    std::unique_ptr<siv::PerlinNoise> perlin;
-
     FloatParameter* brightness;
     FloatParameter* scale;
+    IntParameter* octaves;
+    BoolParameter* spatial;
     FloatParameter* contrast;
     FloatParameter* balance;
     ColorParameter* frontColor;
     ColorParameter* bgColor;
 
+    Array<float> xBuffer;
+    Array<Vector3D<float>> positionBuffer;
+    Array<float> noiseBuffer;
+
     virtual void fillColorsForObjectTimeInternal(Array<Colour, CriticalSection>& colors, Object* o, ColorComponent* comp, int id, float time, float originalTime) override;
    
     ColorParameter* getMainColorParameter() override { return frontColor; }
@@ -43,6 +43,10 @@ void PictureColorSource::fillColorsForObjectTimeInternal(Array<Colour, CriticalS
 	float txRel = fmodf(time, 1);
 	int  tx = jmin<int>(txRel * picture.getWidth(), picture.getWidth() - 1);
 
+	const float hueVal = GetSourceLinkedValue(hue);
+	const float saturationVal = GetSourceLinkedValue(saturation);
+	const float brightnessVal = GetSourceLinkedValue(brightness);
+
 	const int resolution = colors.size();
 	for (int i = 0; i < resolution; i++)
 	{
@@ -50,6 +54,6 @@ void PictureColorSource::fillColorsForObjectTimeInternal(Array<Colour, CriticalS
 
 		float h = 0, s = 0, b = 0;
 		picture.getPixelAt(tx, ty).getHSB(h, s, b);
-		colors.set(i, Colour::fromHSV(h + (float)GetSourceLinkedValue(hue), jmin(1.0f, s * (float)GetSourceLinkedValue(saturation)), jmin(1.0f, b * (float)GetSourceLinkedValue(brightness)), 1));
+		colors.set(i, Colour::fromHSV(h + hueVal, jmin(1.0f, s * saturationVal), jmin(1.0f, b * brightnessVal), 1));
 	}
 }
@@ -26,13 +26,19 @@ void PixelMapColorSource::fillColorsForObjectTimeInternal(Array<Colour, Critical
     if (!sourceImage.isValid()) return;
 
     PixelShape* shape = comp->pixelShape.get();
-    const int resolution = colors.size();
+    if (shape == nullptr) return;
+
+    PixelShape::PositionTable::Ptr table = shape->getPositionTable();
+    const Array<Vector3D<float>>& positions = table->positions;
+    const int resolution = jmin(colors.size(), positions.size());
+    const int imageWidth = sourceImage.getWidth();
+    const int imageHeight = sourceImage.getHeight();
     for (int i = 0; i < resolution; i++)
     {
-        Vector3D<float> p = shape->getPositionForPixel(i);
-        int tx = p.x * sourceImage.getWidth();
-        int ty = p.y * sourceImage.getHeight();
-        if (tx < 0 || tx >= sourceImage.getWidth() || ty < 0 || ty >= sourceImage.getHeight()) continue;
+        const Vector3D<float>& p = positions.getReference(i);
+        int tx = p.x * imageWidth;
+        int ty = p.y * imageHeight;
+        if (tx < 0 || tx >= imageWidth || ty < 0 || ty >= imageHeight) continue;
 
 
         Colour col = sourceImage.getPixelAt(tx, ty);
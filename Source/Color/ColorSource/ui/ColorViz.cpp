@@ -40,9 +40,13 @@ void ColorViz::paint(Graphics& g)
     
     Rectangle<int> vizR = r.reduced(pixelSize / 2);
 
+    PixelShape::PositionTable::Ptr table = comp->pixelShape->getPositionTable();
+    const Array<Vector3D<float>>& normPositions = table->normalizedPositions;
+    resolution = jmin(resolution, normPositions.size(), comp->outColors.size());
+
     for (int i = 0; i < resolution; i++)
     {
-        Vector3D<float> relPos = comp->pixelShape->getNormalizedPositionForPixel(i);
+        const Vector3D<float>& relPos = normPositions.getReference(i);
         Point<int> pos = vizR.getRelativePoint(relPos.x, 1-relPos.y); //invert Y to have 0 on bottom
 
         Colour c = comp->outColors[i];
@@ -11,7 +11,8 @@
 PixelShape::PixelShape(const String& name, int resolution) :
     BaseItem(name, false, false),
     resolution(resolution),
-    needsSquareRatio(false)
+    needsSquareRatio(false),
+    positionsDirty(true)
 {
 }
 
@@ -19,20 +20,88 @@ PixelShape::~PixelShape()
 {
 }
 
+void PixelShape::setResolution(int value)
+{
+    if (resolution == value) return;
+    resolution = value;
+    invalidatePositions();
+}
+
+void PixelShape::invalidatePositions()
+{
+    positionsDirty = true;
+}
+
+void PixelShape::updatePositions()
+{
+    GenericScopedLock lock(positionsLock);
+    if (!positionsDirty) return;
+    positionsDirty = false; //set before computing so a change happening meanwhile will trigger a new update
+
+    preparePositions();
+
+    positions.resize(resolution);
+    Vector3D<float>* pos = positions.getRawDataPointer();
+    for (int i = 0; i < resolution; i++) pos[i] = computePositionForPixel(i);
+
+    updateBounds();
+
+    PositionTable::Ptr table = new PositionTable();
+    table->positions = positions;
+    table->normalizedPositions.resize(resolution);
+    Vector3D<float>* normPos = table->normalizedPositions.getRawDataPointer();
+    for (int i = 0; i < resolution; i++) normPos[i] = bounds.getNormalizedPosition(pos[i]);
+
+    positionTable = table;
+}
+
+PixelShape::PositionTable::Ptr PixelShape::getPositionTable()
+{
+    if (positionsDirty) updatePositions();
+
+    GenericScopedLock lock(positionsLock);
+    if (positionTable == nullptr) return new PositionTable();
+    return positionTable;
+}
+
 Vector3D<float> PixelShape::getPositionForPixel(int index)
 {
-    return Vector3D<float>();
+    PositionTable::Ptr table = getPositionTable();
+    return isPositiveAndBelow(index, table->positions.size()) ? table->positions.getUnchecked(index) : Vector3D<float>();
 }
 
 Vector3D<float> PixelShape::getNormalizedPositionForPixel(int index)
 {
-    return bounds.getNormalizedPosition(getPositionForPixel(index));
+    PositionTable::Ptr table = getPositionTable();
+    return isPositiveAndBelow(index, table->normalizedPositions.size()) ? table->normalizedPositions.getUnchecked(index) : Vector3D<float>();
+}
+
+Vector3D<float> PixelShape::computePositionForPixel(int index)
+{
+    return Vector3D<float>();
+}
+
+void PixelShape::updateBounds()
+{
+    if (positions.isEmpty())
+    {
+        bounds.minPos = Vector3D<float>();
+        bounds.maxPos = Vector3D<float>();
+        return;
+    }
+
+    bounds.minPos = bounds.maxPos = positions[0];
+    for (auto& p : positions)
+    {
+        bounds.minPos = Vector3D<float>(jmin(bounds.minPos.x, p.x), jmin(bounds.minPos.y, p.y), jmin(bounds.minPos.z, p.z));
+        bounds.maxPos = Vector3D<float>(jmax(bounds.maxPos.x, p.x), jmax(bounds.maxPos.y, p.y), jmax(bounds.maxPos.z, p.z));
+    }
 }
 
 void PixelShape::onContainerParameterChangedInternal(Parameter* p)
 {
     BaseItem::onContainerParameterChangedInternal(p);
-    updateBounds();
+    invalidatePositions();
 }
 
 
@@ -61,7 +130,7 @@ LinePixelShape::~LinePixelShape()
 {
 }
 
-Vector3D<float> LinePixelShape::getPositionForPixel(int index)
+Vector3D<float> LinePixelShape::computePositionForPixel(int index)
 {
     float p = index * 1.0f / jmax(resolution-1, 1);
     return start->getVector() + (end->getVector() - start->getVector()) * p;
@@ -91,7 +160,7 @@ CirclePixelShape::~CirclePixelShape()
 {
 }
 
-Vector3D<float> CirclePixelShape::getPositionForPixel(int index)
+Vector3D<float> CirclePixelShape::computePositionForPixel(int index)
 {
     float angle = (index * 1.0f / resolution) * float_Pi * 2;
     angle += startAngle->floatValue() * float_Pi / 180.f;
@@ -109,3 +178,216 @@ void CirclePixelShape::updateBounds()
     bounds.minPos = center->getVector() - Vector3D<float>(rad, rad, 0);
     bounds.maxPos = center->getVector() + Vector3D<float>(rad, rad, 0);
 }
+
+//---------------
+
+GridPixelShape::GridPixelShape(int resolution) :
+    PixelShape("Grid", resolution)
+{
+    center = addPoint3DParameter("Center", "Center of the grid");
+    size = addPoint2DParameter("Size", "Width and height of the grid");
+    columns = addIntParameter("Columns", "Number of pixels per row, the number of rows is deduced from the resolution", 8, 1);
+    startCorner = addEnumParameter("Start Corner", "Corner where the first pixel is wired");
+    startCorner->addOption("Top Left", TOP_LEFT)->addOption("Top Right", TOP_RIGHT)->addOption("Bottom Left", BOTTOM_LEFT)->addOption("Bottom Right", BOTTOM_RIGHT);
+    wiring = addEnumParameter("Wiring", "Whether pixels are wired along rows or along columns");
+    wiring->addOption("Rows", ROWS)->addOption("Columns", COLUMNS);
+    serpentine = addBoolParameter("Serpentine", "If checked, every other line is wired in the opposite direction, as in most LED matrices", true);
+
+    center->setVector(0, 0, 0);
+    size->setPoint(2, 2);
+}
+
+GridPixelShape::~GridPixelShape()
+{
+}
+
+Vector3D<float> GridPixelShape::computePositionForPixel(int index)
+{
+    const int numCols = jmax(columns->intValue(), 1);
+    const int numRows = jmax((int)ceilf(resolution * 1.0f / numCols), 1);
+    const bool byRows = wiring->getValueDataAsEnum<Wiring>() == ROWS;
+
+    const int lineLength = byRows ? numCols : numRows;
+    const int line = index / lineLength;
+    int posInLine = index % lineLength;
+    if (serpentine->boolValue() && line % 2 == 1) posInLine = lineLength - 1 - posInLine;
+
+    int col = byRows ? posInLine : line;
+    int row = byRows ? line : posInLine;
+
+    StartCorner corner = startCorner->getValueDataAsEnum<StartCorner>();
+    if (corner == TOP_RIGHT || corner == BOTTOM_RIGHT) col = numCols - 1 - col;
+    if (corner == BOTTOM_LEFT || corner == BOTTOM_RIGHT) row = numRows - 1 - row;
+
+    float tx = numCols > 1 ? col * 1.0f / (numCols - 1) : .5f;
+    float ty = numRows > 1 ? row * 1.0f / (numRows - 1) : .5f;
+
+    Vector3D<float> c = center->getVector();
+    return Vector3D<float>(c.x + (tx - .5f) * size->x, c.y + (.5f - ty) * size->y, c.z); //row 0 is on top
+}
+
+//---------------
+
+PolylinePixelShape::PolylinePixelShape(int resolution) :
+    PixelShape("Polyline", resolution),
+    points("Points")
+{
+    closed = addBoolParameter("Closed", "If checked, the last point is connected back to the first one", false);
+
+    points.userCanAddControllables = true;
+    points.userAddControllablesFilters.add(Point3DParameter::getTypeStringStatic());
+    addChildControllableContainer(&points);
+
+    addPoint(Vector3D<float>(-1, 0, 0));
+    addPoint(Vector3D<float>(1, 0, 0));
+}
+
+PolylinePixelShape::~PolylinePixelShape()
+{
+}
+
+Point3DParameter* PolylinePixelShape::addPoint(Vector3D<float> pos)
+{
+    Point3DParameter* p = points.addPoint3DParameter("Point " + String(points.controllables.size() + 1), "Position of this point");
+    p->isRemovableByUser = true;
+    p->setVector(pos.x, pos.y, pos.z);
+    return p;
+}
+
+void PolylinePixelShape::preparePositions()
+{
+    segmentPoints.clearQuick();
+    for (auto& c : points.controllables)
+    {
+        if (Point3DParameter* p = dynamic_cast<Point3DParameter*>(c)) segmentPoints.add(p->getVector());
+    }
+
+    if (closed->boolValue() && segmentPoints.size() > 2) segmentPoints.add(segmentPoints[0]);
+
+    segmentDistances.clearQuick();
+    float dist = 0;
+    for (int i = 0; i < segmentPoints.size(); i++)
+    {
+        if (i > 0) dist += (segmentPoints[i] - segmentPoints[i - 1]).length();
+        segmentDistances.add(dist);
+    }
+}
+
+Vector3D<float> PolylinePixelShape::computePositionForPixel(int index)
+{
+    if (segmentPoints.isEmpty()) return Vector3D<float>();
+
+    const float totalLength = segmentDistances.getLast();
+    if (segmentPoints.size() == 1 || totalLength == 0) return segmentPoints[0];
+
+    //a closed shape should not put the last pixel on top of the first one
+    float p = closed->boolValue() ? index * 1.0f / jmax(resolution, 1) : index * 1.0f / jmax(resolution - 1, 1);
+    float target = p * totalLength;
+
+    int seg = 1;
+    while (seg < segmentDistances.size() - 1 && segmentDistances[seg] < target) seg++;
+
+    float segLength = segmentDistances[seg] - segmentDistances[seg - 1];
+    float t = segLength > 0 ? (target - segmentDistances[seg - 1]) / segLength : 0;
+    return segmentPoints[seg - 1] + (segmentPoints[seg] - segmentPoints[seg - 1]) * t;
+}
+
+void PolylinePixelShape::controllableAdded(Controllable* c)
+{
+    PixelShape::controllableAdded(c);
+    if (c->parentContainer == &points)
+    {
+        c->isRemovableByUser = true;
+        invalidatePositions();
+    }
+}
+
+void PolylinePixelShape::controllableRemoved(Controllable* c)
+{
+    PixelShape::controllableRemoved(c);
+    invalidatePositions();
+}
+
+void PolylinePixelShape::onControllableFeedbackUpdateInternal(ControllableContainer* cc, Controllable* c)
+{
+    PixelShape::onControllableFeedbackUpdateInternal(cc, c);
+    if (cc == &points) invalidatePositions();
+}
+
+var PolylinePixelShape::getJSONData()
+{
+    var data = PixelShape::getJSONData();
+    var pointsData;
+    for (auto& c : points.controllables)
+    {
+        if (Point3DParameter* p = dynamic_cast<Point3DParameter*>(c)) pointsData.append(p->getValue());
+    }
+    data.getDynamicObject()->setProperty("points", pointsData);
+    return data;
+}
+
+void PolylinePixelShape::loadJSONDataInternal(var data)
+{
+    PixelShape::loadJSONDataInternal(data);
+
+    var pointsData = data.getProperty("points", var());
+    if (!pointsData.isArray()) return;
+
+    while (points.controllables.size() > 0) points.removeControllable(points.controllables[0]);
+    for (int i = 0; i < pointsData.size(); i++)
+    {
+        var pData = pointsData[i];
+        addPoint(Vector3D<float>(pData[0], pData[1], pData[2]));
+    }
+}
+
+//---------------
+
+CSVPixelShape::CSVPixelShape(int resolution) :
+    PixelShape("CSV", resolution)
+{
+    file = addFileParameter("File", "CSV file with one pixel per line, written as x,y or x,y,z");
+    scale = addFloatParameter("Scale", "Multiplier applied to the positions read from the file", 1, 0);
+}
+
+CSVPixelShape::~CSVPixelShape()
+{
+}
+
+void CSVPixelShape::loadPoints()
+{
+    Array<Vector3D<float>> newPoints;
+
+    File f = file->getFile();
+    if (f.existsAsFile())
+    {
+        StringArray lines;
+        f.readLines(lines);
+
+        for (auto& l : lines)
+        {
+            StringArray values;
+            values.addTokens(l, ",;\t ", "\"");
+            values.removeEmptyStrings();
+            if (values.size() < 2 || !values[0].containsAnyOf("0123456789")) continue; //skip headers and empty lines
+
+            newPoints.add(Vector3D<float>(values[0].getFloatValue(), values[1].getFloatValue(), values.size() > 2 ? values[2].getFloatValue() : 0));
+        }
+    }
+
+    GenericScopedLock lock(positionsLock);
+    filePoints.swapWith(newPoints);
+    invalidatePositions();
+}
+
+Vector3D<float> CSVPixelShape::computePositionForPixel(int index)
+{
+    if (filePoints.isEmpty()) return Vector3D<float>();
+    return filePoints[jmin(index, filePoints.size() - 1)] * scale->floatValue();
+}
+
+void CSVPixelShape::onContainerParameterChangedInternal(Parameter* p)
+{
+    PixelShape::onContainerParameterChangedInternal(p);
+    if (p == file) loadPoints();
+}
@@ -28,10 +28,34 @@ public:
     };
     Bounds3D bounds;
 
+    //Contiguous tables of resolution items, rebuilt lazily after a parameter or resolution change.
+    //A rebuild publishes a new table, so readers keep using the one they got while it is replaced.
+    struct PositionTable :
+        public ReferenceCountedObject
+    {
+        Array<Vector3D<float>> positions;
+        Array<Vector3D<float>> normalizedPositions;
+
+        typedef ReferenceCountedObjectPtr<PositionTable> Ptr;
+    };
+
+    SpinLock positionsLock;
+    std::atomic<bool> positionsDirty;
+    Array<Vector3D<float>> positions; //working table, only used under positionsLock while updating
+    PositionTable::Ptr positionTable;
+
+    void setResolution(int value);
+    void invalidatePositions();
+    void updatePositions();
 
-    virtual Vector3D<float> getPositionForPixel(int index);
-    virtual Vector3D<float>  getNormalizedPositionForPixel(int index);
-    virtual void updateBounds() {}
+    PositionTable::Ptr getPositionTable();
+
+    Vector3D<float> getPositionForPixel(int index);
+    Vector3D<float> getNormalizedPositionForPixel(int index);
+
+    virtual void preparePositions() {}
+    virtual Vector3D<float> computePositionForPixel(int index);
+    virtual void updateBounds();
 
     virtual void onContainerParameterChangedInternal(Parameter* p) override;
 };
@@ -56,7 +80,7 @@ public:
     Point3DParameter* start;
     Point3DParameter* end;
 
-    virtual Vector3D<float>  getPositionForPixel(int index) override;
+    virtual Vector3D<float> computePositionForPixel(int index) override;
     virtual void updateBounds() override;
 
     String getTypeString() const override { return "Line"; }
@@ -74,8 +98,79 @@ public:
     FloatParameter* radius;
     FloatParameter* startAngle;
 
-    virtual Vector3D<float>  getPositionForPixel(int index) override;
+    virtual Vector3D<float> computePositionForPixel(int index) override;
     virtual void updateBounds() override;
 
     String getTypeString() const override { return "Circle"; }
+};
+
+class GridPixelShape :
+    public PixelShape
+{
+public:
+    GridPixelShape(int resolution = 1);
+    virtual ~GridPixelShape();
+
+    enum StartCorner { TOP_LEFT, TOP_RIGHT, BOTTOM_LEFT, BOTTOM_RIGHT };
+    enum Wiring { ROWS, COLUMNS };
+
+    Point3DParameter* center;
+    Point2DParameter* size;
+    IntParameter* columns;
+    EnumParameter* startCorner;
+    EnumParameter* wiring;
+    BoolParameter* serpentine;
+
+    virtual Vector3D<float> computePositionForPixel(int index) override;
+
+    String getTypeString() const override { return "Grid"; }
+};
+
+class PolylinePixelShape :
+    public PixelShape
+{
+public:
+    PolylinePixelShape(int resolution = 1);
+    virtual ~PolylinePixelShape();
+
+    ControllableContainer points;
+    BoolParameter* closed;
+
+    Array<Vector3D<float>> segmentPoints;
+    Array<float> segmentDistances;
+
+    Point3DParameter* addPoint(Vector3D<float> pos = Vector3D<float>());
+
+    virtual void preparePositions() override;
+    virtual Vector3D<float> computePositionForPixel(int index) override;
+
+    void controllableAdded(Controllable* c) override;
+    void controllableRemoved(Controllable* c) override;
+    void onControllableFeedbackUpdateInternal(ControllableContainer* cc, Controllable* c) override;
+
+    var getJSONData() override;
+    void loadJSONDataInternal(var data) override;
+
+    String getTypeString() const override { return "Polyline"; }
+};
+
+class CSVPixelShape :
+    public PixelShape
+{
+public:
+    CSVPixelShape(int resolution = 1);
+    virtual ~CSVPixelShape();
+
+    FileParameter* file;
+    FloatParameter* scale;
+
+    Array<Vector3D<float>> filePoints;
+
+    void loadPoints();
+
+    virtual Vector3D<float> computePositionForPixel(int index) override;
+
+    void onContainerParameterChangedInternal(Parameter* p) override;
+
+    String getTypeString() const override { return "CSV"; }
 };
\ No newline at end of file
@@ -21,8 +21,8 @@ void PixelShapeChooser::clicked()
 {
     PopupMenu m;
 
-    const int numTypes = 3;
-    const String typeNames[numTypes]{"Point", "Line", "Circle" };
+    const int numTypes = 6;
+    const String typeNames[numTypes]{"Point", "Line", "Circle", "Grid", "Polyline", "CSV" };
     for (int i = 0; i < numTypes; i++) m.addItem(i + 1, typeNames[i]);
 
     m.showMenuAsync(PopupMenu::Options(), [this, typeNames](int result)
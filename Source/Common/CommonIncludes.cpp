@@ -16,6 +16,7 @@
 #include "Effect/EffectIncludes.h"
 
 
+#include "ParameterLink/BakedAutomation.cpp"
 #include "ParameterLink/ParameterLink.cpp"
 #include "ParameterLink/ui/LinkableParameterEditor.cpp"
 
@@ -23,8 +24,9 @@
 #include "Action/ActionManager.cpp"
 
 #include "Helpers/SceneHelpers.cpp"
-#include "Helpers/TimedEffectHiresTimer.cpp"
+#include "Helpers/EngineClock.cpp"
 #include "Helpers/ColorHelpers.cpp"
+#include "Helpers/NoiseHelpers.cpp"
 
 #include "MIDI/MIDIDevice.cpp"
 #include "MIDI/MIDIDeviceParameter.cpp"
@@ -17,6 +17,7 @@
 #include "Spatializer/ui/SpatItemViewUI.h"
 #include "Spatializer/ui/SpatManagerView.h"
 
+#include "ParameterLink/BakedAutomation.h"
 #include "ParameterLink/ParameterLink.h"
 #include "ParameterLink/ui/LinkableParameterEditor.h"
 
@@ -28,8 +29,9 @@
 
 
 #include "Helpers/SceneHelpers.h"
-#include "Helpers/TimedEffectHiresTimer.h"
+#include "Helpers/EngineClock.h"
 #include "Helpers/ColorHelpers.h"
+#include "Helpers/NoiseHelpers.h"
 
 #include "MIDI/MIDIDevice.h"
 #include "MIDI/MIDIManager.h"
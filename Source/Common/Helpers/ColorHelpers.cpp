@@ -11,6 +11,8 @@
 #include "Common/CommonIncludes.h"
 
 HashMap<int, Colour> ColorHelpers::temperatureColorMap;
+float ColorHelpers::temperatureLUT[ColorHelpers::temperatureLUTSize][3];
+bool ColorHelpers::temperatureLUTInitialized = false;
 
 void ColorHelpers::init()
 {
@@ -125,100 +127,125 @@ void ColorHelpers::init()
 	temperatureColorMap.set(11800, Colour(196, 210, 255));
 	temperatureColorMap.set(11900, Colour(195, 210, 255));
 	temperatureColorMap.set(12000, Colour(195, 209, 255));
+
+	for (int i = 0; i < temperatureLUTSize; i++)
+	{
+		Colour c = temperatureColorMap[temperatureMin + i * temperatureStep];
+		temperatureLUT[i][0] = c.getFloatRed();
+		temperatureLUT[i][1] = c.getFloatGreen();
+		temperatureLUT[i][2] = c.getFloatBlue();
+	}
+
+	temperatureLUTInitialized = true;
 }
 
 Colour ColorHelpers::getColorForTemperature(float temperature)
 {
-	if (temperatureColorMap.size() == 0)
-		init();
-
-	int temp = jlimit<int>(1000, 12000, temperature);
-	temp = roundToInt(temp / 100) * 100;
-
-	// Constructor
-	//
-	return temperatureColorMap[temp];
+	float rgb[3];
+	getRGBForTemperature(temperature, rgb);
+	return Colour::fromFloatRGBA(rgb[0], rgb[1], rgb[2], 1);
 }
 
-var ColorHelpers::getRGBWFromRGB(Colour col, float temperature)
+void ColorHelpers::getRGBForTemperature(float temperature, float* rgbOut)
 {
-	Colour tempColor = getColorForTemperature(temperature);
-
-	float r = col.getFloatRed();
-	float g = col.getFloatGreen();
-	float b = col.getFloatBlue();
-
-	float tempRed = tempColor.getFloatRed();
-	float tempGreen = tempColor.getFloatGreen();
-	float tempBlue = tempColor.getFloatBlue();
-
-	// Calculate all of the color's white values corrected taking into account the white color temperature.
-	float wRed = r / tempRed;
-	float wGreen = g / tempGreen;
-	float wBlue = b / tempBlue;
-
-	// Determine the smallest white value from above.
-	float wMin = jmin(wRed, wGreen, wBlue);
-
-	// Make the color with the smallest white value to be the output white value
-	float wOut;
-	if (wMin == wRed)
-		wOut = r;
-	else if (wMin == wGreen)
-		wOut = g;
-	else
-		wOut = b;
-
-	// Calculate the output red, green and blue values, taking into account the white color temperature.
-	float rOut = r - wOut * tempRed;
-	float gOut = g - wOut * tempGreen;
-	float bOut = b - wOut * tempBlue;
+	if (!temperatureLUTInitialized) init();
 
-	var result;
-	result.append(rOut);
-	result.append(gOut);
-	result.append(bOut);
-	result.append(wOut);
-	result.append(0);
+	float pos = (jlimit<float>(temperatureMin, temperatureMax, temperature) - temperatureMin) / temperatureStep;
+	int index = jmin((int)pos, temperatureLUTSize - 2);
+	float rel = pos - index;
 
-	return result;
+	for (int i = 0; i < 3; i++) rgbOut[i] = jmap(rel, temperatureLUT[index][i], temperatureLUT[index + 1][i]);
 }
 
-var ColorHelpers::getRGBWAFromRGB(Colour col, float temperature)
+void ColorHelpers::getRGBWFromRGB(const float* rgbIn, float* out, int numPixels, float temperature)
+{
+	float tempRGB[3];
+	getRGBForTemperature(temperature, tempRGB);
+
+	const float invTempRed = 1.0f / tempRGB[0];
+	const float invTempGreen = 1.0f / tempRGB[1];
+	const float invTempBlue = 1.0f / tempRGB[2];
+
+	for (int i = 0; i < numPixels; i++)
+	{
+		const float* in = rgbIn + i * 3;
+		float* o = out + i * 5;
+
+		float r = in[0];
+		float g = in[1];
+		float b = in[2];
+
+		// Calculate all of the color's white values corrected taking into account the white color temperature.
+		float wRed = r * invTempRed;
+		float wGreen = g * invTempGreen;
+		float wBlue = b * invTempBlue;
+
+		// Make the color with the smallest white value to be the output white value
+		float wOut = b;
+		if (wRed <= wGreen && wRed <= wBlue) wOut = r;
+		else if (wGreen <= wBlue) wOut = g;
+
+		// Calculate the output red, green and blue values, taking into account the white color temperature.
+		o[0] = r - wOut * tempRGB[0];
+		o[1] = g - wOut * tempRGB[1];
+		o[2] = b - wOut * tempRGB[2];
+		o[3] = wOut;
+		o[4] = 0;
+	}
+}
+
+void ColorHelpers::getRGBWAFromRGB(const float* rgbIn, float* out, int numPixels, float temperature)
 {
-	Colour tempColor = getColorForTemperature(temperature);
+	float tempRGB[3];
+	getRGBForTemperature(temperature, tempRGB);
 
-	float r = col.getFloatRed();
-	float g = col.getFloatGreen();
-	float b = col.getFloatBlue();
+	const float invTempRed = 1.0f / tempRGB[0];
+	const float invTempGreen = 1.0f / tempRGB[1];
+	const float invTempBlue = 1.0f / tempRGB[2];
 
-	float tempRed = tempColor.getFloatRed();
-	float tempGreen = tempColor.getFloatGreen();
-	float tempBlue = tempColor.getFloatBlue();
+	for (int i = 0; i < numPixels; i++)
+	{
+		const float* in = rgbIn + i * 3;
+		float* o = out + i * 5;
 
-	// Calculate all of the color's white values corrected taking into account the white color temperature.
-	float wRed = r / tempRed;
-	float wGreen = g / tempGreen;
-	float wBlue = b / tempBlue;
+		float r = in[0];
+		float g = in[1];
+		float b = in[2];
 
-	float wOut = jmin(wRed, wGreen, wBlue);
+		float wOut = jmin(r * invTempRed, g * invTempGreen, b * invTempBlue);
 
-	float wr = r - wOut * tempRed;
-	float wg = g - wOut * tempGreen;
-	float wb = b - wOut * tempBlue;
+		float wr = r - wOut * tempRGB[0];
+		float wg = g - wOut * tempRGB[1];
+		float wb = b - wOut * tempRGB[2];
 
-	float aOut = wr;
-	if (aOut > wg * 2) aOut = wg * 2;
-	float rOut = wr - aOut;
-	float gOut = wg - aOut / 2;
-	float bOut = wb;
+		float aOut = jmin(wr, wg * 2);
+
+		o[0] = wr - aOut;
+		o[1] = wg - aOut / 2;
+		o[2] = wb;
+		o[3] = wOut;
+		o[4] = aOut;
+	}
+}
+
+var ColorHelpers::getRGBWFromRGB(Colour col, float temperature)
+{
+	float rgb[3] = { col.getFloatRed(), col.getFloatGreen(), col.getFloatBlue() };
+	float out[5];
+	getRGBWFromRGB(rgb, out, 1, temperature);
 
 	var result;
-	result.append(rOut);
-	result.append(gOut);
-	result.append(bOut);
-	result.append(wOut);
-	result.append(aOut);
+	for (int i = 0; i < 5; i++) result.append(out[i]);
+	return result;
+}
 
+var ColorHelpers::getRGBWAFromRGB(Colour col, float temperature)
+{
+	float rgb[3] = { col.getFloatRed(), col.getFloatGreen(), col.getFloatBlue() };
+	float out[5];
+	getRGBWAFromRGB(rgb, out, 1, temperature);
+
+	var result;
+	for (int i = 0; i < 5; i++) result.append(out[i]);
 	return result;
 }
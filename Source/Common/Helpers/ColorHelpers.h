@@ -15,8 +15,22 @@ class ColorHelpers
 {
 public:
     static HashMap<int, Colour> temperatureColorMap;
+
+    //Precomputed Kelvin -> RGB table, one entry every 100K from 1000K to 12000K, interpolated on lookup
+    static const int temperatureMin = 1000;
+    static const int temperatureMax = 12000;
+    static const int temperatureStep = 100;
+    static const int temperatureLUTSize = (temperatureMax - temperatureMin) / temperatureStep + 1;
+    static float temperatureLUT[temperatureLUTSize][3];
+    static bool temperatureLUTInitialized;
+
     static void init();
     static Colour getColorForTemperature(float temperature);
+    static void getRGBForTemperature(float temperature, float* rgbOut);
+
+    //Batched extraction, rgbIn is numPixels * 3 floats (r,g,b), out is numPixels * 5 floats (r,g,b,w,a)
+    static void getRGBWFromRGB(const float* rgbIn, float* out, int numPixels, float temperature);
+    static void getRGBWAFromRGB(const float* rgbIn, float* out, int numPixels, float temperature);
 
     static var getRGBWFromRGB(Colour val, float temperature);
     static var getRGBWAFromRGB(Colour val, float temperature);
@@ -0,0 +1,87 @@
+/*
+  ==============================================================================
+
+	EngineClock.cpp
+	Created: 18 Oct 2026 10:12:31am
+	Author:  bkupe
+
+  ==============================================================================
+*/
+
+#include "Common/CommonIncludes.h"
+
+juce_ImplementSingleton(EngineClock);
+
+EngineClock::EngineClock() :
+	tickTime(Time::getMillisecondCounterHiRes() / 1000.0),
+	deltaTime(0),
+	realTimeOffset(0),
+	mode(REAL_TIME),
+	requestedMode(REAL_TIME),
+	virtualRate(50),
+	requestedRate(50),
+	virtualFreeRun(false),
+	tickRate(50),
+	frameIndex(0)
+{
+}
+
+void EngineClock::setMode(ClockMode m, int rate, bool freeRun)
+{
+	requestedRate = jmax(rate, 1);
+	virtualFreeRun = freeRun;
+	requestedMode = m;
+}
+
+void EngineClock::tick()
+{
+	const bool modeChanged = requestedMode != mode;
+	const int newRate = requestedRate;
+	if (modeChanged)
+	{
+		mode = (ClockMode)requestedMode.load();
+		virtualRate = newRate;
+		frameIndex = 0;
+		realTimeOffset = 0;
+	}
+	else if (newRate != virtualRate)
+	{
+		//the next virtual tick follows the current time at the new rate, frameIndex / newRate would jump
+		if (mode == VIRTUAL) frameIndex = (int64)std::floor(tickTime * newRate + 1e-6) + 1;
+		virtualRate = newRate;
+	}
+
+	const double newTime = mode == VIRTUAL ? frameIndex++ / (double)virtualRate : Time::getMillisecondCounterHiRes() / 1000.0 + realTimeOffset;
+
+	if (modeChanged)
+	{
+		tickTime = newTime;
+		deltaTime = 0;
+		clockListeners.call(&ClockListener::clockReset);
+		clockListeners.call(&ClockListener::clockTicked);
+		return;
+	}
+
+	tick(newTime);
+}
+
+void EngineClock::tick(double newTime)
+{
+	deltaTime = newTime - tickTime;
+	tickTime = newTime;
+
+	clockListeners.call(&ClockListener::clockTicked);
+}
+
+void EngineClock::resumeRealTime()
+{
+	if (mode == VIRTUAL) frameIndex = (int64)std::ceil(tickTime * virtualRate);
+	else realTimeOffset = tickTime - Time::getMillisecondCounterHiRes() / 1000.0;
+}
+
+void EngineClock::reset(double newTime)
+{
+	tickTime = newTime;
+	deltaTime = 0;
+	clockListeners.call(&ClockListener::clockReset);
+}
@@ -0,0 +1,58 @@
+/*
+  ==============================================================================
+
+	EngineClock.h
+	Created: 18 Oct 2026 10:12:31am
+	Author:  bkupe
+
+  ==============================================================================
+*/
+
+#pragma once
+
+class EngineClock
+{
+public:
+	juce_DeclareSingleton(EngineClock, true);
+
+	EngineClock();
+	~EngineClock() {}
+
+	//In real time mode, ticks sample the system clock. In virtual mode, tick N is exactly N / virtualRate seconds,
+	//so the output only depends on the number of ticks, not on when or how fast they are computed.
+	enum ClockMode { REAL_TIME, VIRTUAL };
+
+	//Snapshot taken once per ObjectManager tick, before updateStart, so effects and color sources all sample the same time
+	double tickTime;
+	double deltaTime;
+	double realTimeOffset; //keeps real time ticks continuous after the clock was driven from a virtual time
+
+	ClockMode mode;
+	std::atomic<int> requestedMode; //applied at the next tick, on the thread that ticks
+	std::atomic<int> virtualRate; //only changed by the thread that ticks, read by the others
+	std::atomic<int> requestedRate; //applied at the next tick, like requestedMode
+	std::atomic<bool> virtualFreeRun; //in virtual mode, compute the ticks as fast as possible instead of pacing them
+	std::atomic<int> tickRate; //rate the ticks are actually driven at, set by what drives them (compute thread, offline render)
+	int64 frameIndex;
+
+	bool isVirtual() const { return mode == VIRTUAL; }
+	void setMode(ClockMode m, int rate, bool freeRun);
+
+	void tick();
+	void tick(double newTime); //used to drive the engine from a virtual time, e.g. for offline rendering
+	void resumeRealTime(); //continue from the current tick time after tick(double) was used
+	void reset(double newTime); //jump to a time without a delta, time references are taken again
+
+	class ClockListener
+	{
+	public:
+		/** Destructor. */
+		virtual ~ClockListener() {}
+		virtual void clockTicked() {}
+		virtual void clockReset() {} //time jumped because the mode changed, time references should be taken again
+	};
+
+	ListenerList<ClockListener> clockListeners;
+	void addClockListener(ClockListener* newListener) { clockListeners.add(newListener); }
+	void removeClockListener(ClockListener* listener) { clockListeners.remove(listener); }
+};
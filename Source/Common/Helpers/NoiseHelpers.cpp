@@ -0,0 +1,56 @@
+/*
+  ==============================================================================
+
+    NoiseHelpers.cpp
+    Created: 18 Oct 2026 11:03:47am
+    Author:  bkupe
+
+  ==============================================================================
+*/
+
+#include "Common/CommonIncludes.h"
+
+#define FNL_IMPL
+#include "Common/Helpers/FastNoiseLite.h"
+
+static fnl_state createNoiseState(const NoiseHelpers::NoiseSettings& settings)
+{
+	fnl_state state = fnlCreateState();
+	state.seed = settings.seed;
+	state.frequency = settings.frequency;
+	state.octaves = jmax(settings.octaves, 1);
+	state.lacunarity = settings.lacunarity;
+	state.gain = settings.gain;
+	state.fractal_type = settings.octaves > 1 ? FNL_FRACTAL_FBM : FNL_FRACTAL_NONE;
+
+	switch (settings.type)
+	{
+	case NoiseHelpers::PERLIN: state.noise_type = FNL_NOISE_PERLIN; break;
+	case NoiseHelpers::SIMPLEX: state.noise_type = FNL_NOISE_OPENSIMPLEX2; break;
+	case NoiseHelpers::VALUE: state.noise_type = FNL_NOISE_VALUE_CUBIC; break;
+	}
+
+	return state;
+}
+
+void NoiseHelpers::fill2D(const NoiseSettings& settings, const float* x, float y, float* out, int numPoints)
+{
+	fnl_state state = createNoiseState(settings);
+	for (int i = 0; i < numPoints; i++) out[i] = fnlGetNoise2D(&state, x[i], y);
+}
+
+void NoiseHelpers::fill3D(const NoiseSettings& settings, const Vector3D<float>* points, float* out, int numPoints, Vector3D<float> offset)
+{
+	fnl_state state = createNoiseState(settings);
+	for (int i = 0; i < numPoints; i++)
+	{
+		const Vector3D<float>& p = points[i];
+		out[i] = fnlGetNoise3D(&state, p.x + offset.x, p.y + offset.y, p.z + offset.z);
+	}
+}
+
+float NoiseHelpers::getNoise2D(const NoiseSettings& settings, float x, float y)
+{
+	fnl_state state = createNoiseState(settings);
+	return fnlGetNoise2D(&state, x, y);
+}
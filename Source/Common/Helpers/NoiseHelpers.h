@@ -0,0 +1,33 @@
+/*
+  ==============================================================================
+
+    NoiseHelpers.h
+    Created: 18 Oct 2026 11:03:47am
+    Author:  bkupe
+
+  ==============================================================================
+*/
+
+#pragma once
+
+class NoiseHelpers
+{
+public:
+    enum NoiseType { PERLIN, SIMPLEX, VALUE };
+
+    struct NoiseSettings
+    {
+        NoiseType type = PERLIN;
+        float frequency = 1;
+        int octaves = 1; //more than 1 enables fractal (fbm) noise
+        float lacunarity = 2;
+        float gain = .5f;
+        int seed = 1337;
+    };
+
+    //All fill functions write one value per point in out, between -1 and 1
+    static void fill2D(const NoiseSettings& settings, const float* x, float y, float* out, int numPoints);
+    static void fill3D(const NoiseSettings& settings, const Vector3D<float>* points, float* out, int numPoints, Vector3D<float> offset = Vector3D<float>());
+
+    static float getNoise2D(const NoiseSettings& settings, float x, float y);
+};
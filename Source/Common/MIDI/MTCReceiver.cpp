@@ -11,15 +11,34 @@
 MTCReceiver::MTCReceiver(MIDIInputDevice* device) :
 	isPlaying(false),
 	hours(0), minutes(0), seconds(0), frames(0), type(MidiMessage::SmpteTimecodeType::fps30),
+	divider(30),
+	lastPiece(-1),
+	numChasePoints(0),
+	chaseWriteIndex(0),
+	chaseOriginHost(0),
+	chaseOriginTime(0),
+	chaseRate(1),
+	qfPosition(-1),
+	lastQuarterFrameTime(0),
+	lastPosition(0),
+	freewheelTime(.5),
+	relockThreshold(2),
+	jitterMs(0),
+	maxJitterMs(0),
+	drift(0),
+	numRelocks(0),
+	isFreewheeling(false),
 	device(nullptr)
 {
 	MIDIManager::getInstance()->addMIDIManagerListener(this);
+	EngineClock::getInstance()->addClockListener(this);
 	setDevice(device);
 }
 
 MTCReceiver::~MTCReceiver()
 {
 	if(MIDIManager::getInstanceWithoutCreating() != nullptr) MIDIManager::getInstance()->removeMIDIManagerListener(this);
+	if (EngineClock::getInstanceWithoutCreating() != nullptr) EngineClock::getInstance()->removeClockListener(this);
 	stopTimer();
 	setDevice(nullptr);
 }
@@ -43,26 +62,58 @@ void MTCReceiver::setDevice(MIDIInputDevice* newDevice)
 
 double MTCReceiver::getTime()
 {
-	return (double)(hours * 3600 + minutes * 60 + seconds) + (frames * 1.0 / divider);
+	return getTimeAt(Time::getMillisecondCounterHiRes() / 1000.0);
+}
+
+double MTCReceiver::getTimeAt(double hostTime)
+{
+	GenericScopedLock lock(chaseLock);
+	return getChaseTimeInternal(hostTime);
+}
+
+double MTCReceiver::getFrameRate(MidiMessage::SmpteTimecodeType t)
+{
+	switch (t)
+	{
+	case MidiMessage::fps24: return 24;
+	case MidiMessage::fps25: return 25;
+	case MidiMessage::fps30drop: return 30000.0 / 1001;
+	case MidiMessage::fps30: return 30;
+	}
+
+	return 30;
+}
+
+double MTCReceiver::timecodeToSeconds(int h, int m, int s, int f) const
+{
+	if (type != MidiMessage::fps30drop) return (double)(h * 3600 + m * 60 + s) + f / divider;
+
+	//drop frame labels skip frames 0 and 1 of each minute, except every tenth minute
+	int totalMinutes = h * 60 + m;
+	int frameNumber = (totalMinutes * 60 + s) * 30 + f - 2 * (totalMinutes - totalMinutes / 10);
+	return frameNumber / divider;
 }
 
 void MTCReceiver::fullFrameTimecodeReceived(const MidiMessage& m)
 {
 	m.getFullFrameParameters(hours, minutes, seconds, frames, type);
-	switch (type)
+	divider = getFrameRate(type);
+
 	{
-	case MidiMessage::fps24: divider = 24;
-	case MidiMessage::fps25: divider = 25;
-	case MidiMessage::fps30: divider = 30;
-	case MidiMessage::fps30drop: divider = 29.997;
+		//full frames are locates, the chase starts over from the new position
+		GenericScopedLock lock(chaseLock);
+		resetChase();
+		qfPosition = -1;
+		lastPosition = timecodeToSeconds(hours, minutes, seconds, frames);
 	}
 
 	mtcListeners.call(&MTCListener::mtcTimeUpdated, true);
-
 }
 
 void MTCReceiver::quarterFrameTimecodeReceived(const MidiMessage& m)
 {
+	double now = Time::getMillisecondCounterHiRes() / 1000.0;
+
 	int piece = m.getQuarterFrameSequenceNumber();
 	pieces[piece] = m.getQuarterFrameValue();
 
@@ -72,30 +123,118 @@ void MTCReceiver::quarterFrameTimecodeReceived(const MidiMessage& m)
 		seconds = (pieces[(int)Piece::SecondLSB] & 0x0F) | ((pieces[(int)Piece::SecondMSB] & 0x03) << 4);
 		minutes = (pieces[(int)Piece::MinuteLSB] & 0x0F) | ((pieces[(int)Piece::MinuteMSB] & 0x03) << 4);
 		hours = (pieces[(int)Piece::HourLSB] & 0x0F) | ((pieces[(int)Piece::RateAndHourMSB] & 0x01) << 4);
-		MidiMessage::SmpteTimecodeType newType = (MidiMessage::SmpteTimecodeType)(pieces[(int)Piece::RateAndHourMSB] & 0x03);
+		MidiMessage::SmpteTimecodeType newType = (MidiMessage::SmpteTimecodeType)((pieces[(int)Piece::RateAndHourMSB] >> 1) & 0x03);
 
 		if (type != newType)
 		{
 			type = newType;
-			switch (type)
-			{
-			case MidiMessage::fps24: divider = 24;
-			case MidiMessage::fps25: divider = 25;
-			case MidiMessage::fps30: divider = 30;
-			case MidiMessage::fps30drop: divider = 29.997;
-			}
+			divider = getFrameRate(type);
 		}
+	}
+
+	bool started = false;
+	{
+		GenericScopedLock lock(chaseLock);
 
-		if (!isPlaying)
+		if ((Piece)piece == Piece::RateAndHourMSB && lastPiece == (int)Piece::HourLSB)
+		{
+			//the sequence describes the frame on which its first piece was sent, the last piece arrives 7 quarter frames later
+			qfPosition = timecodeToSeconds(hours, minutes, seconds, frames) + 1.75 / divider;
+		}
+		else if (qfPosition >= 0 && piece == (lastPiece + 1) % 8)
+		{
+			qfPosition += .25 / divider;
+		}
+		else
 		{
+			//out of order pieces (reverse playback or lost messages), wait for the next complete sequence
+			qfPosition = -1;
+		}
+
+		lastPiece = piece;
+		lastQuarterFrameTime = now;
+		isFreewheeling = false;
+
+		if (qfPosition >= 0)
+		{
+			addChasePoint(now, qfPosition);
+			started = !isPlaying;
 			isPlaying = true;
-			mtcListeners.call(&MTCListener::mtcStarted);
 		}
+	}
 
-		startTimerHz(divider /  5);
+	if (started)
+	{
+		startTimerHz(20);
+		mtcListeners.call(&MTCListener::mtcStarted);
 	}
+}
 
-	mtcListeners.call(&MTCListener::mtcTimeUpdated, false);
+void MTCReceiver::addChasePoint(double hostTime, double mtcTime)
+{
+	if (numChasePoints > 0 && fabs(getChaseTimeInternal(hostTime) - mtcTime) > relockThreshold / divider)
+	{
+		resetChase();
+		numRelocks++;
+	}
+
+	chasePoints[chaseWriteIndex] = { hostTime, mtcTime };
+	chaseWriteIndex = (chaseWriteIndex + 1) % chaseWindowSize;
+	numChasePoints = jmin(numChasePoints + 1, chaseWindowSize);
+
+	double meanHost = 0;
+	double meanTime = 0;
+	for (int i = 0; i < numChasePoints; i++)
+	{
+		meanHost += chasePoints[i].hostTime;
+		meanTime += chasePoints[i].mtcTime;
+	}
+	meanHost /= numChasePoints;
+	meanTime /= numChasePoints;
+
+	double covariance = 0;
+	double variance = 0;
+	for (int i = 0; i < numChasePoints; i++)
+	{
+		double dh = chasePoints[i].hostTime - meanHost;
+		covariance += dh * (chasePoints[i].mtcTime - meanTime);
+		variance += dh * dh;
+	}
+
+	//not enough history for a reliable slope, run at nominal speed from the last quarter frame
+	bool hasSlope = numChasePoints >= 8 && variance > 0;
+	chaseRate = hasSlope ? jlimit(.5, 2.0, covariance / variance) : 1;
+	chaseOriginHost = hasSlope ? meanHost : hostTime;
+	chaseOriginTime = hasSlope ? meanTime : mtcTime;
+
+	double sumSq = 0;
+	double maxError = 0;
+	for (int i = 0; i < numChasePoints; i++)
+	{
+		double error = fabs(chasePoints[i].mtcTime - getChaseTimeInternal(chasePoints[i].hostTime));
+		sumSq += error * error;
+		maxError = jmax(maxError, error);
+	}
+
+	jitterMs = sqrt(sumSq / numChasePoints) * 1000;
+	maxJitterMs = maxError * 1000;
+	drift = chaseRate - 1;
+}
+
+void MTCReceiver::resetChase()
+{
+	numChasePoints = 0;
+	chaseWriteIndex = 0;
+	chaseRate = 1;
+	jitterMs = 0;
+	maxJitterMs = 0;
+	drift = 0;
+}
+
+double MTCReceiver::getChaseTimeInternal(double hostTime) const
+{
+	if (numChasePoints == 0) return lastPosition;
+	return chaseOriginTime + chaseRate * (hostTime - chaseOriginHost);
 }
 
 void MTCReceiver::midiDeviceInRemoved(MIDIInputDevice* d)
@@ -103,9 +242,29 @@ void MTCReceiver::midiDeviceInRemoved(MIDIInputDevice* d)
 	if (d == device) setDevice(nullptr);
 }
 
+void MTCReceiver::clockTicked()
+{
+	//sequences read the chased time once per engine tick instead of once per decoded sequence
+	if (isPlaying) mtcListeners.call(&MTCListener::mtcTimeUpdated, false);
+}
+
 void MTCReceiver::timerCallback()
 {
-	isPlaying = false;
-	mtcListeners.call(&MTCListener::mtcStopped);
+	double elapsed = Time::getMillisecondCounterHiRes() / 1000.0 - lastQuarterFrameTime;
+
+	{
+		GenericScopedLock lock(chaseLock);
+		isFreewheeling = elapsed > 2 / divider;
+		if (elapsed < freewheelTime) return;
+
+		lastPosition = qfPosition >= 0 ? qfPosition : getChaseTimeInternal(lastQuarterFrameTime);
+		resetChase();
+		qfPosition = -1;
+		lastPiece = -1;
+		isFreewheeling = false;
+		isPlaying = false;
+	}
+
 	stopTimer();
+	mtcListeners.call(&MTCListener::mtcStopped);
 }
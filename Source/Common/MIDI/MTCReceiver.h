@@ -13,6 +13,7 @@
 class MTCReceiver :
 	public MIDIInputDevice::MIDIInputListener,
 	public MIDIManager::Listener,
+	public EngineClock::ClockListener,
 	public Timer
 {
 public:
@@ -40,17 +41,59 @@ public:
 	};
 
 	int pieces[8];
-	
+	int lastPiece;
+
+	//Chase clock : each quarter frame is timestamped on arrival and fitted with a linear regression over the last frames,
+	//so getTime() is a smooth sub-frame position that keeps running between quarter frames and through short dropouts.
+	static const int chaseWindowSize = 32; //quarter frames, 8 frames of history
+
+	struct ChasePoint
+	{
+		double hostTime;
+		double mtcTime;
+	};
+
+	SpinLock chaseLock;
+	ChasePoint chasePoints[chaseWindowSize];
+	int numChasePoints;
+	int chaseWriteIndex;
+
+	double chaseOriginHost; //fitted clock is mtc = chaseOriginTime + chaseRate * (host - chaseOriginHost)
+	double chaseOriginTime;
+	double chaseRate;
+
+	double qfPosition; //timecode of the last quarter frame, -1 until a full sequence has been decoded
+	double lastQuarterFrameTime;
+	double lastPosition; //position held when not playing
+
+	double freewheelTime; //seconds without quarter frames before the timecode is considered stopped
+	double relockThreshold; //in frames, a larger error drops the history and locks again on the new position
+
+	//Jitter metrics, updated on each quarter frame
+	double jitterMs; //rms distance between quarter frame arrivals and the fitted clock
+	double maxJitterMs; //peak distance over the window
+	double drift; //rate of the source relative to the local clock, 0.001 means 0.1% fast
+	int numRelocks;
+	bool isFreewheeling;
 
 	void setDevice(MIDIInputDevice* newDevice);
 
 	double getTime();
+	double getTimeAt(double hostTime);
+
+	static double getFrameRate(MidiMessage::SmpteTimecodeType t);
+	double timecodeToSeconds(int h, int m, int s, int f) const;
 
 	void fullFrameTimecodeReceived(const MidiMessage &m) override;
 	void quarterFrameTimecodeReceived(const MidiMessage &m) override;
 
+	void addChasePoint(double hostTime, double mtcTime);
+	void resetChase();
+	double getChaseTimeInternal(double hostTime) const;
+
 	void midiDeviceInRemoved(MIDIInputDevice* d) override;
 
+	void clockTicked() override;
 	void timerCallback() override;
 	
 	class MTCListener
@@ -0,0 +1,164 @@
+/*
+  ==============================================================================
+
+    BakedAutomation.cpp
+    Created: 18 Oct 2026 2:41:09pm
+    Author:  bkupe
+
+  ==============================================================================
+*/
+
+BakedAutomationPool::BakedAutomationPool() :
+	enabled(false),
+	samplesPerSecond(200),
+	maxBytes(4 * 1024 * 1024),
+	usedBytes(0),
+	version(0)
+{
+}
+
+void BakedAutomationPool::setup(bool _enabled, float _samplesPerSecond, int64 _maxBytes)
+{
+	enabled = _enabled;
+	samplesPerSecond = jmax(_samplesPerSecond, 1.f);
+	maxBytes = _maxBytes;
+	version++;
+}
+
+bool BakedAutomationPool::allocate(int64 bytes)
+{
+	int64 used = usedBytes.load();
+	do
+	{
+		if (used + bytes > maxBytes) return false;
+	} while (!usedBytes.compare_exchange_weak(used, used + bytes));
+
+	return true;
+}
+
+void BakedAutomationPool::release(int64 bytes)
+{
+	usedBytes -= bytes;
+}
+
+//---------------
+
+BakedAutomation::BakedAutomation(Parameter* p, BakedAutomationPool* pool) :
+	parameter(p),
+	pool(pool),
+	numChannels(1),
+	numSamples(0),
+	bakedLength(0),
+	bakedVersion(-1),
+	allocatedBytes(0),
+	isDirty(true),
+	lastEditTime(0)
+{
+	if (parameter->automation != nullptr)
+	{
+		automationContainer = parameter->automation->automationContainer;
+		if (automationContainer != nullptr) automationContainer->addControllableContainerListener(this);
+	}
+}
+
+BakedAutomation::~BakedAutomation()
+{
+	if (automationContainer != nullptr) automationContainer->removeControllableContainerListener(this);
+	clear();
+}
+
+bool BakedAutomation::bake()
+{
+	clear();
+	isDirty = false;
+
+	ParameterAutomation* a = parameter->automation.get();
+	if (a == nullptr || automationContainer == nullptr) return false;
+
+	Automation* curve = dynamic_cast<Automation*>(a->automationContainer);
+	GradientColorManager* gradient = dynamic_cast<GradientColorManager*>(a->automationContainer);
+	if (curve == nullptr && gradient == nullptr) return false;
+
+	bakedLength = a->lengthParamRef->floatValue();
+	bakedVersion = pool->version;
+	if (bakedLength <= 0) return false;
+
+	numChannels = gradient != nullptr ? 4 : 1;
+	numSamples = jmax(2, (int)ceilf(bakedLength * pool->samplesPerSecond) + 1);
+
+	int64 bytes = (int64)numSamples * numChannels * sizeof(float);
+	if (!pool->allocate(bytes)) return false;
+	allocatedBytes = bytes;
+
+	samples.resize(numSamples * numChannels);
+	float* s = samples.getRawDataPointer();
+	for (int i = 0; i < numSamples; i++)
+	{
+		float pos = i * bakedLength / (numSamples - 1);
+		if (curve != nullptr)
+		{
+			s[i] = curve->getValueAtPosition(pos);
+		}
+		else
+		{
+			Colour c = gradient->getColorForPosition(pos);
+			s[i * 4] = c.getFloatRed();
+			s[i * 4 + 1] = c.getFloatGreen();
+			s[i * 4 + 2] = c.getFloatBlue();
+			s[i * 4 + 3] = c.getFloatAlpha();
+		}
+	}
+
+	return true;
+}
+
+void BakedAutomation::clear()
+{
+	if (allocatedBytes > 0) pool->release(allocatedBytes);
+	allocatedBytes = 0;
+	numSamples = 0;
+	samples.clearQuick();
+}
+
+bool BakedAutomation::getValueAtTime(float time, float* out)
+{
+	if (!pool->enabled) return false;
+
+	ParameterAutomation* a = parameter->automation.get();
+	if (a == nullptr) return false;
+
+	if (!isDirty && (bakedVersion != pool->version || bakedLength != a->lengthParamRef->floatValue())) isDirty = true;
+
+	if (isDirty)
+	{
+		//a negative difference means the clock was reset after the edit, which counts as settled
+		const double sinceEdit = EngineClock::getInstance()->tickTime - lastEditTime;
+		if (sinceEdit >= 0 && sinceEdit < editSettleTime) return false;
+		bake();
+	}
+
+	if (numSamples == 0) return false; //not baked, probably over budget
+
+	float pos = fmodf(time, bakedLength) / bakedLength * (numSamples - 1);
+	if (pos < 0) pos += numSamples - 1;
+
+	int index = jlimit(0, numSamples - 2, (int)pos);
+	float t = jlimit(0.f, 1.f, pos - index);
+
+	const float* s = samples.getRawDataPointer() + index * numChannels;
+	for (int i = 0; i < numChannels; i++) out[i] = s[i] + (s[i + numChannels] - s[i]) * t;
+
+	return true;
+}
+
+void BakedAutomation::controllableFeedbackUpdate(ControllableContainer* cc, Controllable* c)
+{
+	isDirty = true;
+	lastEditTime = EngineClock::getInstance()->tickTime;
+}
+
+void BakedAutomation::childStructureChanged(ControllableContainer* cc)
+{
+	isDirty = true;
+	lastEditTime = EngineClock::getInstance()->tickTime;
+}
@@ -0,0 +1,68 @@
+/*
+  ==============================================================================
+
+    BakedAutomation.h
+    Created: 18 Oct 2026 2:41:09pm
+    Author:  bkupe
+
+  ==============================================================================
+*/
+
+#pragma once
+
+//Shared settings and memory budget for all the automations baked in a sequence
+class BakedAutomationPool :
+    public ReferenceCountedObject
+{
+public:
+    BakedAutomationPool();
+    ~BakedAutomationPool() {}
+
+    typedef ReferenceCountedObjectPtr<BakedAutomationPool> Ptr;
+
+    bool enabled;
+    float samplesPerSecond;
+    int64 maxBytes;
+    std::atomic<int64> usedBytes;
+    std::atomic<int> version; //incremented when settings change, so baked automations know they have to rebake
+
+    void setup(bool enabled, float samplesPerSecond, int64 maxBytes);
+
+    bool allocate(int64 bytes);
+    void release(int64 bytes);
+};
+
+//Uniformly sampled copy of a parameter automation, used on the compute thread instead of walking keys and easings.
+//Edits only mark it dirty, exact evaluation is used until the edit is settled and the table is baked again.
+class BakedAutomation :
+    public ControllableContainerListener
+{
+public:
+    BakedAutomation(Parameter* p, BakedAutomationPool* pool);
+    ~BakedAutomation();
+
+    static constexpr double editSettleTime = .3; //seconds of engine time, so baking is reproducible with a virtual clock
+
+    Parameter* parameter;
+    WeakReference<ControllableContainer> automationContainer;
+    BakedAutomationPool::Ptr pool;
+
+    Array<float> samples;
+    int numChannels;
+    int numSamples;
+    float bakedLength;
+    int bakedVersion;
+    int64 allocatedBytes;
+
+    bool isDirty;
+    double lastEditTime;
+
+    bool bake();
+    void clear();
+
+    //returns false if the baked table can't be used and the automation should be evaluated directly
+    bool getValueAtTime(float time, float* out);
+
+    void controllableFeedbackUpdate(ControllableContainer* cc, Controllable* c) override;
+    void childStructureChanged(ControllableContainer* cc) override;
+};
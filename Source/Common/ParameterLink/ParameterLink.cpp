@@ -15,6 +15,9 @@ ParameterLink::ParameterLink(WeakReference<Parameter> p) :
 	parameter(p),
 	isLinkable(true),
 	spatializer(nullptr),
+	cachedObject(nullptr),
+	cachedID(-1),
+	cachedTick(0),
 	isLinkBeingDestroyed(false),
 	//replacementHasMappingInputToken(false),
 	paramLinkNotifier(5)
@@ -132,8 +135,27 @@ var ParameterLink::getLinkedValue(Object* o, int id)
 	return parameter->getValue();
 }
 
+var ParameterLink::getCachedLinkedValue(Object* o, int id)
+{
+	ObjectManager* om = ObjectManager::getInstanceWithoutCreating();
+	if (om == nullptr || !om->isComputeThread()) return getLinkedValue(o, id);
+
+	if (o == cachedObject && id == cachedID && cachedTick == om->computeTick) return cachedValue;
 
+	cachedValue = getLinkedValue(o, id);
+	cachedObject = o;
+	cachedID = id;
+	cachedTick = om->computeTick;
 
+	return cachedValue;
+}
+
+void ParameterLink::invalidateCache()
+{
+	cachedObject = nullptr;
+	cachedID = -1;
+	cachedTick = 0;
+}
 
 
 WeakReference<Controllable> ParameterLink::getLinkedTarget(Object* o)
@@ -146,7 +168,17 @@ WeakReference<Controllable> ParameterLink::getLinkedTarget(Object* o)
 
 	if (linkType == CUSTOM_PARAM)
 	{
-		if (TargetParameter* p = dynamic_cast<TargetParameter*>(o->customParams->getActiveParamFor(linkedCustomParam))) return p->target;
+		bool found = false;
+		WeakReference<Controllable> target;
+		o->customParams->callWithActiveParamFor(linkedCustomParam, [&found, &target](Parameter* ap)
+			{
+				if (TargetParameter* p = dynamic_cast<TargetParameter*>(ap))
+				{
+					found = true;
+					target = p->target;
+				}
+			});
+		if (found) return target;
 	}
 
 	if (parameter->type == Parameter::TARGET) return ((TargetParameter*)parameter.get())->target;
@@ -163,7 +195,17 @@ WeakReference<ControllableContainer> ParameterLink::getLinkedTargetContainer(Obj
 
 	if (linkType == CUSTOM_PARAM)
 	{
-		if (TargetParameter* p = dynamic_cast<TargetParameter*>(o->customParams->getActiveParamFor(linkedCustomParam))) return p->targetContainer;
+		bool found = false;
+		WeakReference<ControllableContainer> targetContainer;
+		o->customParams->callWithActiveParamFor(linkedCustomParam, [&found, &targetContainer](Parameter* ap)
+			{
+				if (TargetParameter* p = dynamic_cast<TargetParameter*>(ap))
+				{
+					found = true;
+					targetContainer = p->targetContainer;
+				}
+			});
+		if (found) return targetContainer;
 	}
 
 	if (parameter->type == Parameter::TARGET) return ((TargetParameter*)parameter.get())->targetContainer;
@@ -290,6 +332,7 @@ void ParameterLink::itemsRemoved(Array<SpatItem*> items)
 
 void ParameterLink::notifyLinkUpdated()
 {
+	invalidateCache();
 	parameterLinkListeners.call(&ParameterLinkListener::linkUpdated, this);
 	paramLinkNotifier.addMessage(new ParameterLinkEvent(ParameterLinkEvent::PREVIEW_UPDATED, this));
 }
@@ -332,12 +375,15 @@ void ParameterLink::loadJSONData(var data)
 ParamLinkContainer::ParamLinkContainer(const String& name) :
 	ControllableContainer(name),
 	paramsCanBeLinked(true),
+	numActiveLinks(0),
 	ghostData(new DynamicObject())
 {
 }
 
 ParamLinkContainer::~ParamLinkContainer()
 {
+	bakedAutomationMap.clear();
+	bakedAutomations.clear();
 	paramLinkMap.clear();
 	paramLinks.clear();
 }
@@ -360,6 +406,8 @@ void ParamLinkContainer::onControllableAdded(Controllable* c)
 		{
 			pLink->loadJSONData(ghostData.getProperty(pLink->parameter->shortName, var()));
 		}
+
+		updateNumActiveLinks();
 	}
 }
 
@@ -380,13 +428,22 @@ void ParamLinkContainer::onControllableRemoved(Controllable* c)
 				linkParamMap.remove(pLink);
 				paramLinkMap.remove(p);
 				paramLinks.removeObject(pLink);
+				updateNumActiveLinks();
 			}
 		}
+
+		GenericScopedLock lock(bakedLock);
+		if (BakedAutomation* ba = bakedAutomationMap[p])
+		{
+			bakedAutomationMap.remove(p);
+			bakedAutomations.removeObject(ba);
+		}
 	}
 }
 
 void ParamLinkContainer::parameterControlModeChanged(Parameter* p)
 {
+	updateBakedAutomation(p);
 	paramLinkContainerListeners.call(&ParamLinkContainerListener::paramControlModeChanged, this, getLinkedParam(p));
 }
 
@@ -401,10 +458,10 @@ ParameterLink* ParamLinkContainer::getLinkedParam(Parameter* p)
 var ParamLinkContainer::getLinkedValue(Parameter* p, Object* o, int id, float time)
 {
 	if (p == nullptr) return var();
-	if (!paramsCanBeLinked) return getParamValue(p, time);
+	if (!paramsCanBeLinked || numActiveLinks == 0) return getParamValue(p, time);
 	if (ParameterLink* pLink = getLinkedParam(p))
 	{
-		if (pLink->linkType != ParameterLink::NONE) return pLink->getLinkedValue(o, id);
+		if (pLink->linkType != ParameterLink::NONE) return pLink->getCachedLinkedValue(o, id);
 	}
 	return getParamValue(p, time);
 }
@@ -415,6 +472,26 @@ var ParamLinkContainer::getParamValue(Parameter* p, float time)
 
 	if (ParameterAutomation* a = p->automation.get())
 	{
+		if (bakePool != nullptr && (ObjectManager::getInstance()->isComputeThread() || ObjectManager::getInstance()->isRenderAheadThread()))
+		{
+			float values[4];
+			int numChannels = 0;
+			{
+				//the table may be rebaked here, and deleted by the message thread as soon as the lock is released
+				GenericScopedLock lock(bakedLock);
+				BakedAutomation* ba = bakedAutomationMap[p];
+				if (ba != nullptr && ba->getValueAtTime(time, values)) numChannels = ba->numChannels;
+			}
+
+			if (numChannels == 1) return values[0];
+			if (numChannels > 1)
+			{
+				var result;
+				for (int i = 0; i < numChannels; i++) result.append(values[i]);
+				return result;
+			}
+		}
+
 		if (dynamic_cast<Automation*>(a->automationContainer) != nullptr)
 		{
 			float value = ((Automation*)a->automationContainer)->getValueAtPosition(fmodf(time, a->lengthParamRef->floatValue()));
@@ -436,8 +513,47 @@ var ParamLinkContainer::getParamValue(Parameter* p, float time)
 }
 
 
+void ParamLinkContainer::setBakePool(BakedAutomationPool* pool)
+{
+	if (bakePool.get() == pool) return;
+	bakePool = pool;
+
+	{
+		GenericScopedLock lock(bakedLock);
+		bakedAutomationMap.clear();
+		bakedAutomations.clear();
+	}
+
+	for (auto& pLink : paramLinks) if (pLink->parameter != nullptr) updateBakedAutomation(pLink->parameter);
+}
+
+void ParamLinkContainer::updateBakedAutomation(Parameter* p)
+{
+	GenericScopedLock lock(bakedLock);
+
+	if (BakedAutomation* ba = bakedAutomationMap[p])
+	{
+		bakedAutomationMap.remove(p);
+		bakedAutomations.removeObject(ba);
+	}
+
+	if (bakePool == nullptr || p->controlMode != Parameter::AUTOMATION || p->automation == nullptr) return;
+
+	BakedAutomation* ba = new BakedAutomation(p, bakePool.get());
+	bakedAutomations.add(ba);
+	bakedAutomationMap.set(p, ba);
+}
+
+void ParamLinkContainer::updateNumActiveLinks()
+{
+	int count = 0;
+	for (auto& pLink : paramLinks) if (pLink->linkType != ParameterLink::NONE) count++;
+	numActiveLinks = count;
+}
+
 void ParamLinkContainer::linkUpdated(ParameterLink* p)
 {
+	updateNumActiveLinks();
 	paramLinkContainerListeners.call(&ParamLinkContainerListener::linkUpdated, this, p);
 }
 
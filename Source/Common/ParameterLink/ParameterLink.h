@@ -34,6 +34,12 @@ public:
     //links
     WeakReference<Parameter> linkedCustomParam; //from ObjectManger custom params
 
+    //resolved value for the last object/id asked during the current ObjectManager tick
+    Object* cachedObject;
+    int cachedID;
+    uint32 cachedTick;
+    var cachedValue;
+
     //bool replacementHasMappingInputToken;
     //String replacementString;
 
@@ -42,6 +48,8 @@ public:
 
     void setLinkedCustomParam(Parameter * p);
     var getLinkedValue(Object * o, int id);
+    var getCachedLinkedValue(Object* o, int id);
+    void invalidateCache();
 
     
 
@@ -88,11 +96,19 @@ public:
     virtual ~ParamLinkContainer();
 
     bool paramsCanBeLinked;
+    int numActiveLinks; //links that are not NONE, allows to skip link resolution entirely
 
     OwnedArray<ParameterLink> paramLinks;
     HashMap<Parameter*, ParameterLink*> paramLinkMap;
     HashMap<ParameterLink*, Parameter*> linkParamMap;
 
+    //automations baked for the compute thread, only if a pool is set (effects in sequences)
+    //bakedLock is held by the compute and render ahead threads while evaluating, and by the message thread while adding or deleting
+    BakedAutomationPool::Ptr bakePool;
+    CriticalSection bakedLock;
+    OwnedArray<BakedAutomation> bakedAutomations;
+    HashMap<Parameter*, BakedAutomation*> bakedAutomationMap;
+
     var ghostData;
 
     virtual void onControllableAdded(Controllable* c) override;
@@ -105,6 +121,10 @@ public:
 
     var getParamValue(Parameter* p, float time = 0);
 
+    void setBakePool(BakedAutomationPool* pool);
+    void updateBakedAutomation(Parameter* p);
+
+    void updateNumActiveLinks();
     virtual void linkUpdated(ParameterLink* p) override;
 
     template<class T>
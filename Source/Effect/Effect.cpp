@@ -104,7 +104,12 @@ void Effect::processComponent(Object* o, ObjectComponent* c, HashMap<Parameter*,
 	FilterResult r = filterManager->getFilteredResultForComponent(o, c);
 	if (r.id == -1) return;
 
-	int targetID = (id != -1 && r.id == o->globalID->intValue()) ? id : r.id;
+	processResolvedComponent(o, c, values, r.weight * weightMultiplier, getTargetID(o, r.id, id), time);
+}
+
+int Effect::getTargetID(Object* o, int filteredID, int id)
+{
+	int targetID = (id != -1 && filteredID == o->globalID->intValue()) ? id : filteredID;
 
 	if (idMode != nullptr)
 	{
@@ -115,7 +120,12 @@ void Effect::processComponent(Object* o, ObjectComponent* c, HashMap<Parameter*,
 		else if (m == RANDOMIZED) targetID = parentGroup->getRandomIDForObject(o);
 	}
 
-	float targetWeight = r.weight * weight->floatValue() * weightMultiplier;
+	return targetID;
+}
+
+void Effect::processResolvedComponent(Object* o, ObjectComponent* c, HashMap<Parameter*, var>& values, float weightMultiplier, int targetID, float time)
+{
+	float targetWeight = weight->floatValue() * weightMultiplier;
 
 	if (targetWeight == 0) return;
 
@@ -146,7 +156,8 @@ void Effect::processComponent(Object* o, ObjectComponent* c, HashMap<Parameter*,
 			values.set(cp, bVal);
 		}
 
-		if (cp == vizComputedParamRef && vizParameter != nullptr && !vizParameter.wasObjectDeleted()) vizParameter->setValue(values[cp]);
+		//values computed ahead by a sequence render-ahead thread are not shown
+		if (cp == vizComputedParamRef && vizParameter != nullptr && !vizParameter.wasObjectDeleted() && ObjectManager::getInstance()->isComputeThread()) vizParameter->setValue(values[cp]);
 	}
 
 	if (computePreviousValues)
@@ -199,6 +210,30 @@ bool Effect::isFullyEnabled()
 	return enabled->boolValue() && !forceDisabled;
 }
 
+bool Effect::canRenderAhead()
+{
+	return !computePreviousValues && !hasLiveParams();
+}
+
+bool Effect::hasLiveParams()
+{
+	//links to custom params and spatializers, expressions and references follow values that can change at any time
+	for (auto& pl : effectParams.paramLinks)
+	{
+		if (pl->linkType == ParameterLink::CUSTOM_PARAM || pl->linkType >= ParameterLink::SPAT_X) return true;
+	}
+
+	for (auto& c : effectParams.controllables)
+	{
+		if (Parameter* p = dynamic_cast<Parameter*>(c))
+		{
+			if (p->controlMode == Parameter::EXPRESSION || p->controlMode == Parameter::REFERENCE) return true;
+		}
+	}
+
+	return false;
+}
+
 var Effect::blendValue(var start, var end, float weight)
 {
 	jassert(start.size() == end.size());
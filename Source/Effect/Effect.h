@@ -59,6 +59,10 @@ public:
 
 	bool isFullyEnabled();
 
+	//the output only depends on the time and the incoming values, so it can be computed ahead (sequence render-ahead)
+	virtual bool canRenderAhead();
+	bool hasLiveParams();
+
 	virtual void onContainerParameterChangedInternal(Parameter* p) override;
 	virtual void onControllableFeedbackUpdateInternal(ControllableContainer* cc, Controllable* c) override;
 
@@ -71,6 +75,9 @@ public:
 	virtual bool isAffectingObject(Object* o);
 	virtual bool isAffectingObjectAndComponent(Object* o, ComponentType t);
 	void processComponent(Object* o, ObjectComponent* c, HashMap<Parameter*, var>& values, float weightMultiplier = 1.0f, int id = -1, float time = -1);
+	//filtering and ID resolution already done, weightMultiplier includes the filter weight (used by compiled effect chains)
+	void processResolvedComponent(Object* o, ObjectComponent* c, HashMap<Parameter*, var>& values, float weightMultiplier, int targetID, float time = -1);
+	int getTargetID(Object* o, int filteredID, int id);
 	virtual void processComponentInternal(Object* o, ObjectComponent* c, const HashMap<Parameter*, var>& values, HashMap<Parameter*, var>& targetValues, int id, float time = -1);
 
 	virtual var blendValue(var start, var end, float weight);
@@ -24,10 +24,12 @@ HSVAdjustEffect::~HSVAdjustEffect()
 
 void HSVAdjustEffect::processedEffectColorsInternal(Array<Colour, CriticalSection>& colors, Object* o, ColorComponent* c, int id, float time)
 {
+    const float hueVal = GetLinkedValue(hue);
+
     int numColors = colors.size();
     for (int i=0;i<numColors;i++)
     {
-        colors.set(i, colors[i].withRotatedHue(GetLinkedValue(hue))
+        colors.set(i, colors[i].withRotatedHue(hueVal)
             .withSaturation(jlimit<float>(0, 1, colors[i].getSaturation() + saturation->floatValue()))
             .withBrightness(jlimit<float>(0, 1, colors[i].getBrightness() + brightness->floatValue()))
         );
@@ -11,7 +11,6 @@
 #include "Effect/EffectIncludes.h"
 #include "Common/CommonIncludes.h"
 
-#define FNL_IMPL
 #include "Common/Helpers/FastNoiseLite.h"
 
 OrientationTargetEffect::OrientationTargetEffect(var params) :
@@ -46,7 +46,7 @@ void SmoothingEffect::onContainerParameterChangedInternal(Parameter* p)
 void SmoothingEffect::processComponentInternal(Object* o, ObjectComponent* c, const HashMap<Parameter*, var>& values, HashMap<Parameter*, var>& targetValues, int id, float time)
 {
 
-	double t = time == -1 ? Time::getMillisecondCounterHiRes() / 1000.0 : time;
+	double t = time == -1 ? EngineClock::getInstance()->tickTime : time;
 	if (!prevTimes.contains(c)) prevTimes.set(c, t);
 
 	if (!prevValuesMap.contains(c)) return;
@@ -54,6 +54,12 @@ void SmoothingEffect::processComponentInternal(Object* o, ObjectComponent* c, co
 	double deltaTime = t - prevTimes[c];
 
 	if (deltaTime == 0) return;
+	if (deltaTime < 0)
+	{
+		//the clock was reset (mode change), start again from here
+		prevTimes.set(c, t);
+		return;
+	}
 
 
 	float smoothVal = GetLinkedValue(smoothing);
@@ -13,7 +13,7 @@
 TimedEffect::TimedEffect(const String& name, var params) :
 	Effect(name, params),
 	forceManualTime(false),
-	timeAtLastUpdate(Time::getMillisecondCounterHiRes() / 1000.0)
+	timeAtLastUpdate(EngineClock::getInstance()->tickTime)
 {
 	computePreviousValues = true;
 
@@ -29,10 +29,13 @@ TimedEffect::TimedEffect(const String& name, var params) :
 
 	ObjectManager::getInstance()->addBaseManagerListener(this);
 	ObjectManager::getInstance()->addObjectManagerListener(this);
+	EngineClock::getInstance()->addClockListener(this);
 }
 
 TimedEffect::~TimedEffect()
 {
+	if (EngineClock::getInstanceWithoutCreating() != nullptr) EngineClock::getInstance()->removeClockListener(this);
+
 	if (ObjectManager::getInstanceWithoutCreating() != nullptr)
 	{
 		ObjectManager::getInstance()->removeBaseManagerListener(this);
@@ -50,7 +53,7 @@ void TimedEffect::updateEnabled()
 {
 	if (isFullyEnabled())
 	{
-		timeAtLastUpdate = Time::getMillisecondCounterHiRes() / 1000.0;
+		timeAtLastUpdate = EngineClock::getInstance()->tickTime;
 		resetTimes();
 		//startTimer(20);
 
@@ -63,6 +66,12 @@ void TimedEffect::updateEnabled()
 	}
 }
 
+bool TimedEffect::canRenderAhead()
+{
+	//previous values are only used by auto reset, and the time is pure when it comes from a sequence block
+	return forceManualTime && !autoResetOnNonZero->boolValue() && !hasLiveParams();
+}
+
 void TimedEffect::processComponentInternal(Object* o, ObjectComponent* c, const HashMap<Parameter*, var>& values, HashMap<Parameter*, var>& targetValues, int id, float time)
 {
 	if (autoResetOnNonZero->boolValue() && c->mainParameter != nullptr) //component needs to have a reference to "main param" for this kind of purpose
@@ -72,7 +81,7 @@ void TimedEffect::processComponentInternal(Object* o, ObjectComponent* c, const
 		Parameter* p = c->mainParameter;
 		if (prevValuesMap[c]->contains(p) && values.contains(p))
 		{
-			if ((float)(*prevValuesMap[c])[p] == 0 && (float)values[p] > 0) curTimes.set(c, 0);
+			if ((float)(*prevValuesMap[c])[p] == 0 && (float)values[p] > 0) getComponentTime(c).time = 0;
 		}
 	}
 
@@ -87,8 +96,7 @@ void TimedEffect::processComponentInternal(Object* o, ObjectComponent* c, const
 
 float TimedEffect::getCurrentTime(Object* o, ObjectComponent* c, int id, float timeOverride)
 {
-	if (!curTimes.contains(c)) curTimes.set(c, 0);
-	if (timeOverride == -1) return curTimes[c];
+	if (timeOverride == -1) return getComponentTime(c).time;
 
 	float time = timeOverride * (float)GetLinkedValueT(speed, timeOverride); //speed should be calculated from start of the animation, if animated (area under curve for automation)
 
@@ -96,22 +104,39 @@ float TimedEffect::getCurrentTime(Object* o, ObjectComponent* c, int id, float t
 }
 
 
+TimedEffect::ComponentTime& TimedEffect::getComponentTime(ObjectComponent* c)
+{
+	if (c->slot >= curTimes.size()) curTimes.resize(c->slot + 1);
+
+	ComponentTime& ct = curTimes.getReference(c->slot);
+	if (ct.component != c || ct.componentRef == nullptr) //slot was never used by this component, or recycled from a deleted one
+	{
+		ct.componentRef = c;
+		ct.component = c;
+		ct.time = 0;
+	}
+
+	return ct;
+}
+
 void TimedEffect::resetTimes()
 {
-	HashMap<ObjectComponent*, float>::Iterator it(curTimes);
-	while (it.next()) curTimes.set(it.getKey(), 0);
+	for (auto& ct : curTimes) ct.time = 0;
 }
 
 void TimedEffect::resetTime(Object* o)
 {
-	for (auto& c : o->componentManager->items) if (curTimes.contains(c)) curTimes.set(c, 0);
+	for (auto& c : o->componentManager->items)
+	{
+		if (c->slot < curTimes.size() && curTimes.getReference(c->slot).component == c) curTimes.getReference(c->slot).time = 0;
+	}
 }
 
 void TimedEffect::itemRemoved(Object* o)
 {
 	for (auto& c : o->componentManager->items)
 	{
-		curTimes.remove(c);
+		if (c->slot < curTimes.size() && curTimes.getReference(c->slot).component == c) curTimes.set(c->slot, ComponentTime());
 
 		if (prevValuesMap.contains(c))
 		{
@@ -127,7 +152,7 @@ void TimedEffect::itemsRemoved(Array<Object*> oList)
 	{
 		for (auto& c : o->componentManager->items)
 		{
-			curTimes.remove(c);
+			if (c->slot < curTimes.size() && curTimes.getReference(c->slot).component == c) curTimes.set(c->slot, ComponentTime());
 
 			if (prevValuesMap.contains(c))
 			{
@@ -151,16 +176,20 @@ void TimedEffect::updateStart()
 
 void TimedEffect::addTime()
 {
-	double newTime = Time::getMillisecondCounterHiRes() / 1000.0;
+	double newTime = EngineClock::getInstance()->tickTime;
+	float delta = newTime - timeAtLastUpdate;
 
-	HashMap<ObjectComponent*, float>::Iterator it(curTimes);
-	while (it.next())
+	for (auto& ct : curTimes)
 	{
-		Object* o = it.getKey()->object;
-		int id = o->globalID->intValue();
-		curTimes.set(it.getKey(), it.getValue() + (newTime - timeAtLastUpdate) * (float)GetLinkedValueT(speed, 0));
+		if (ct.componentRef == nullptr) continue; //removed with or without its object
+		ct.time += delta * (float)GetLinkedValueT(speed, 0);
 	}
 
 	timeAtLastUpdate = newTime;
 
+}
+
+void TimedEffect::clockReset()
+{
+	timeAtLastUpdate = EngineClock::getInstance()->tickTime;
 }
\ No newline at end of file
@@ -16,7 +16,8 @@ class TimedEffect :
 	public Effect,
 	//public HighResolutionTimer,
 	public ObjectManager::ManagerListener,
-	public ObjectManager::ObjectManagerListener
+	public ObjectManager::ObjectManagerListener,
+	public EngineClock::ClockListener
 {
 public:
 	TimedEffect(const String& name, var params = var());
@@ -33,21 +34,32 @@ public:
 	bool forceManualTime;
 
 	double timeAtLastUpdate;
-	HashMap<ObjectComponent*, float> curTimes;
 
+	struct ComponentTime
+	{
+		WeakReference<ControllableContainer> componentRef; //a slot recycled by a new component at the same address is still detected
+		ObjectComponent* component = nullptr;
+		float time = 0;
+	};
+
+	Array<ComponentTime> curTimes; //indexed by ObjectComponent::slot
 
 
 	virtual void onContainerTriggerTriggered(Trigger* t) override;
 	virtual void updateEnabled() override;
+	virtual bool canRenderAhead() override;
 
 	void processComponentInternal(Object* o, ObjectComponent* c, const HashMap<Parameter*, var>& values, HashMap<Parameter*, var>& targetValues, int id, float time = -1) override;
 	virtual void processComponentTimeInternal(Object* o, ObjectComponent* c, const HashMap<Parameter*, var>& values, HashMap<Parameter*, var>& targetValues, int id, float time = -1, float originalTime = -1) {}
 
 	virtual float getCurrentTime(Object* o, ObjectComponent* c, int id, float timeOverride = -1);
+	ComponentTime& getComponentTime(ObjectComponent* c);
 
 	virtual void resetTimes();
 	virtual void resetTime(Object* o);
 
+	void clockReset() override;
+
 	virtual void itemRemoved(Object* o) override;
 	virtual void itemsRemoved(Array<Object*> o) override;
 
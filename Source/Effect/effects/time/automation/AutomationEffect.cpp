@@ -90,12 +90,10 @@ void AutomationEffect::effectParamChanged(Controllable* c)
 		if (!loop->boolValue())
 		{
 			//force put curTime in 0-length range to have good ending behaviour
-			HashMap<ObjectComponent*, float>::Iterator it(curTimes);
-			while (it.next())
+			for (auto& ct : curTimes)
 			{
-				Object* o = it.getKey()->object;
-				int id = o->globalID->intValue();
-				curTimes.set(it.getKey(), fmodf(it.getValue(), GetLinkedValueT(length, 0)));
+				if (ct.componentRef == nullptr) continue;
+				ct.time = fmodf(ct.time, GetLinkedValueT(length, 0));
 			}
 		}
 	}
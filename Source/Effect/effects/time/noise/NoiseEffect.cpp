@@ -14,9 +14,11 @@ NoiseEffect::NoiseEffect(var params) :
 	TimedEffect(getTypeString(), params)
 {
 	type = effectParams.addEnumParameter("Noise Type", "Type of noise to use");
-	type->addOption("Sine", SINE)->addOption("Perlin", PERLIN);
+	type->addOption("Sine", SINE)->addOption("Perlin", PERLIN)->addOption("Simplex", SIMPLEX);
 
 	frequency = effectParams.addFloatParameter("Frequency", "Frequency of the noise. This will act weirdly when animating it !", 1);
+	octaves = effectParams.addIntParameter("Octaves", "Number of fractal layers of noise, more octaves add finer details", 1, 1, 8);
+	spatialScale = effectParams.addFloatParameter("Spatial Scale", "If above 0, the noise is also sampled from the object's stage position, so that close objects get close values", 0, 0);
 	valueRange = effectParams.addPoint2DParameter("Value Range", "Min and Max for this noise");
 	valueRange->setBounds(-1, -1, 1, 1);
 	valueRange->canShowExtendedEditor = false;
@@ -27,8 +29,6 @@ NoiseEffect::NoiseEffect(var params) :
 
 	offsetByID->defaultUI = FloatParameter::TIME;
 	//offsetByValue->defaultUI = FloatParameter::TIME;
-
-	perlin.reset(new siv::PerlinNoise());
 }
 
 NoiseEffect::~NoiseEffect()
@@ -46,8 +46,22 @@ void NoiseEffect::processComponentTimeInternal(Object* o, ObjectComponent* c, co
 	switch (t)
 	{
 	case PERLIN:
-		noiseVal = perlin->noise(time) * 2 + .5f;
-		break;
+	case SIMPLEX:
+	{
+		//Effects are evaluated one component at a time along each component's effect chain, with a time that depends on
+		//its ID offset and linked values, so there is no span of positions to batch here : this is a one point fill.
+		//The state is built on the stack for each call because the same effect also runs on the render-ahead threads.
+		//Perlin values come from FastNoiseLite, they differ from the siv::PerlinNoise values of previous versions.
+		NoiseHelpers::NoiseSettings settings;
+		settings.type = t == PERLIN ? NoiseHelpers::PERLIN : NoiseHelpers::SIMPLEX;
+		settings.octaves = GetLinkedValue(octaves);
+
+		float sScale = GetLinkedValue(spatialScale);
+		Vector3D<float> pos(time, o->stagePosition->x * sScale, o->stagePosition->z * sScale);
+		NoiseHelpers::fill3D(settings, &pos, &noiseVal, 1);
+		noiseVal = noiseVal * .5f + .5f;
+	}
+	break;
 
 	case SINE:
 		noiseVal = sinf(time * float_Pi) * .5f + .5f;
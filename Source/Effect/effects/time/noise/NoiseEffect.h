@@ -10,11 +10,6 @@
 
 #pragma once
 
-namespace siv
-{
-    class PerlinNoise;
-}
-
 class NoiseEffect :
     public TimedEffect
 {
@@ -22,11 +17,12 @@ public:
     NoiseEffect(var params = var());
     ~NoiseEffect();
 
-    enum NoiseType { SINE, PERLIN };
+    enum NoiseType { SINE, PERLIN, SIMPLEX };
     EnumParameter * type;
     FloatParameter* frequency;
+    IntParameter* octaves;
+    FloatParameter* spatialScale;
     Point2DParameter* valueRange;
-    std::unique_ptr<siv::PerlinNoise> perlin;
 
     void processComponentTimeInternal(Object* o, ObjectComponent* c, const HashMap<Parameter*, var>& values, HashMap<Parameter*, var>& targetValues, int id, float time = -1, float originalTime = -1) override;
 
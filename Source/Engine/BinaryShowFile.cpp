@@ -0,0 +1,489 @@
+/*
+  ==============================================================================
+
+    BinaryShowFile.cpp
+    Created: 18 Oct 2026 4:12:37pm
+    Author:  bkupe
+
+  ==============================================================================
+*/
+
+static const char binaryShowMagic[4] = { 'B', 'L', 'X', 'B' };
+
+const char* BinaryShowFile::engineChunkName = "engine";
+
+static void writeRawString(OutputStream& out, const String& s)
+{
+	const size_t numBytes = s.getNumBytesAsUTF8();
+	out.writeCompressedInt((int)numBytes);
+	out.write(s.toRawUTF8(), numBytes);
+}
+
+static bool readRawString(InputStream& in, String& s)
+{
+	int numBytes = in.readCompressedInt();
+	if (numBytes < 0 || (in.getNumBytesRemaining() >= 0 && numBytes > in.getNumBytesRemaining())) return false;
+
+	MemoryBlock b;
+	if (numBytes > 0 && in.readIntoMemoryBlock(b, numBytes) != numBytes) return false;
+	s = String::fromUTF8((const char*)b.getData(), (int)b.getSize());
+	return true;
+}
+
+BinaryShowFile::Writer::Writer(OutputStream* out) :
+	out(out),
+	isValid(out != nullptr)
+{
+	if (!isValid) return;
+
+	out->write(binaryShowMagic, 4);
+	out->writeByte((char)formatVersion);
+	for (int i = 0; i < 3; i++) out->writeByte(0);
+}
+
+bool BinaryShowFile::Writer::writeChunk(const String& name, const var& data)
+{
+	if (!isValid) return false;
+
+	chunkStream.reset();
+	stringIndices.clear();
+	writeValue(data);
+
+	out->writeByte(1);
+	writeRawString(*out, name);
+	out->writeInt((int)chunkStream.getDataSize());
+	isValid = out->write(chunkStream.getData(), chunkStream.getDataSize());
+	return isValid;
+}
+
+bool BinaryShowFile::Writer::finish()
+{
+	if (!isValid) return false;
+	out->writeByte(0);
+	out->flush();
+	return true;
+}
+
+void BinaryShowFile::Writer::writeValue(const var& v)
+{
+	if (v.isBool())
+	{
+		chunkStream.writeByte((char)((bool)v ? TRUE_VALUE : FALSE_VALUE));
+	}
+	else if (v.isInt())
+	{
+		chunkStream.writeByte(INT_VALUE);
+		chunkStream.writeCompressedInt((int)v);
+	}
+	else if (v.isInt64())
+	{
+		chunkStream.writeByte(INT64_VALUE);
+		chunkStream.writeInt64((int64)v);
+	}
+	else if (v.isDouble())
+	{
+		chunkStream.writeByte(DOUBLE_VALUE);
+		chunkStream.writeDouble((double)v);
+	}
+	else if (v.isString())
+	{
+		writeString(v.toString());
+	}
+	else if (v.isArray())
+	{
+		const Array<var>& a = *v.getArray();
+		if (writeTypedArray(a)) return;
+
+		chunkStream.writeByte(ARRAY_VALUE);
+		chunkStream.writeCompressedInt(a.size());
+		for (auto& av : a) writeValue(av);
+	}
+	else if (DynamicObject* o = v.getDynamicObject())
+	{
+		NamedValueSet& props = o->getProperties();
+		chunkStream.writeByte(OBJECT_VALUE);
+		chunkStream.writeCompressedInt(props.size());
+		for (auto& p : props)
+		{
+			writeString(p.name.toString());
+			writeValue(p.value);
+		}
+	}
+	else if (MemoryBlock* b = v.getBinaryData())
+	{
+		chunkStream.writeByte(BINARY_VALUE);
+		chunkStream.writeCompressedInt((int)b->getSize());
+		chunkStream.write(b->getData(), b->getSize());
+	}
+	else
+	{
+		//void, undefined, methods and other objects are not part of the JSON data either
+		chunkStream.writeByte(VOID_VALUE);
+	}
+}
+
+void BinaryShowFile::Writer::writeString(const String& s)
+{
+	if (stringIndices.contains(s))
+	{
+		chunkStream.writeByte(STRING_REF);
+		chunkStream.writeCompressedInt(stringIndices[s]);
+		return;
+	}
+
+	chunkStream.writeByte(STRING_VALUE);
+	writeRawString(chunkStream, s);
+	stringIndices.set(s, stringIndices.size());
+}
+
+bool BinaryShowFile::Writer::writeTypedArray(const Array<var>& a)
+{
+	if (a.size() < 2) return false;
+
+	//only arrays where all the values have the same type, so they are read back exactly as they were
+	bool allInts = true, allDoubles = true, allFloats = true;
+	for (auto& v : a)
+	{
+		allInts &= v.isInt();
+		allDoubles &= v.isDouble();
+		if (allDoubles) allFloats &= (double)(float)(double)v == (double)v;
+		if (!allInts && !allDoubles) return false;
+	}
+
+	if (allInts)
+	{
+		chunkStream.writeByte(INT_ARRAY);
+		chunkStream.writeCompressedInt(a.size());
+		for (auto& v : a) chunkStream.writeCompressedInt((int)v);
+	}
+	else if (allFloats)
+	{
+		chunkStream.writeByte(FLOAT_ARRAY);
+		chunkStream.writeCompressedInt(a.size());
+		for (auto& v : a) chunkStream.writeFloat((float)v);
+	}
+	else
+	{
+		chunkStream.writeByte(DOUBLE_ARRAY);
+		chunkStream.writeCompressedInt(a.size());
+		for (auto& v : a) chunkStream.writeDouble((double)v);
+	}
+
+	return true;
+}
+
+//---------------
+
+BinaryShowFile::Reader::Reader(InputStream* in) :
+	in(in),
+	isValid(false),
+	isFinished(false)
+{
+	if (in == nullptr) return;
+
+	char header[8];
+	if (in->read(header, 8) != 8) return;
+	if (memcmp(header, binaryShowMagic, 4) != 0) return;
+	if ((uint8)header[4] > formatVersion) return;
+
+	isValid = true;
+}
+
+bool BinaryShowFile::Reader::readNextChunk(String& name, var& data)
+{
+	if (!isValid || isFinished) return false;
+
+	if (in->readByte() != 1)
+	{
+		isFinished = true;
+		return false;
+	}
+
+	int size = 0;
+	if (!readRawString(*in, name)) isValid = false;
+	else
+	{
+		size = in->readInt();
+		if (size < 0 || (in->getNumBytesRemaining() >= 0 && size > in->getNumBytesRemaining())) isValid = false;
+	}
+
+	MemoryBlock b;
+	if (isValid && in->readIntoMemoryBlock(b, size) != size) isValid = false;
+
+	if (!isValid)
+	{
+		LOGERROR("Binary show file is corrupted");
+		return false;
+	}
+
+	strings.clearQuick();
+	MemoryInputStream s(b, false);
+	data = readValue(s);
+
+	if (!isValid) LOGERROR("Binary show file chunk " << name << " is corrupted");
+	return isValid;
+}
+
+bool BinaryShowFile::Reader::skipNextChunk(String& name)
+{
+	if (!isValid || isFinished) return false;
+
+	if (in->readByte() != 1)
+	{
+		isFinished = true;
+		return false;
+	}
+
+	if (!readRawString(*in, name))
+	{
+		isValid = false;
+		return false;
+	}
+
+	int size = in->readInt();
+	if (size < 0 || !in->setPosition(in->getPosition() + size)) isValid = false;
+	return isValid;
+}
+
+var BinaryShowFile::Reader::readValue(MemoryInputStream& s)
+{
+	if (!isValid) return var();
+
+	if (s.isExhausted())
+	{
+		isValid = false;
+		return var();
+	}
+
+	int type = s.readByte();
+	int count = 0;
+
+	switch (type)
+	{
+	case VOID_VALUE: return var();
+	case FALSE_VALUE: return false;
+	case TRUE_VALUE: return true;
+	case INT_VALUE: return s.readCompressedInt();
+	case INT64_VALUE: return s.readInt64();
+	case DOUBLE_VALUE: return s.readDouble();
+
+	case STRING_VALUE:
+	case STRING_REF:
+		return readString(s, type);
+
+	case ARRAY_VALUE:
+	{
+		if (!readCount(s, count, 1)) return var();
+		Array<var> a;
+		a.ensureStorageAllocated(count);
+		for (int i = 0; i < count && isValid; i++) a.add(readValue(s));
+		return a;
+	}
+
+	case OBJECT_VALUE:
+	{
+		if (!readCount(s, count, 2)) return var();
+		DynamicObject::Ptr o = new DynamicObject();
+		for (int i = 0; i < count && isValid; i++)
+		{
+			int keyType = s.readByte();
+			String key = readString(s, keyType);
+			if (!isValid || key.isEmpty())
+			{
+				isValid = false;
+				break;
+			}
+			o->setProperty(key, readValue(s));
+		}
+		return var(o.get());
+	}
+
+	case INT_ARRAY:
+	{
+		if (!readCount(s, count, 1)) return var();
+		Array<var> a;
+		a.ensureStorageAllocated(count);
+		for (int i = 0; i < count; i++) a.add(s.readCompressedInt());
+		return a;
+	}
+
+	case FLOAT_ARRAY:
+	{
+		if (!readCount(s, count, 4)) return var();
+		Array<var> a;
+		a.ensureStorageAllocated(count);
+		for (int i = 0; i < count; i++) a.add((double)s.readFloat());
+		return a;
+	}
+
+	case DOUBLE_ARRAY:
+	{
+		if (!readCount(s, count, 8)) return var();
+		Array<var> a;
+		a.ensureStorageAllocated(count);
+		for (int i = 0; i < count; i++) a.add(s.readDouble());
+		return a;
+	}
+
+	case BINARY_VALUE:
+	{
+		if (!readCount(s, count, 1)) return var();
+		MemoryBlock b;
+		s.readIntoMemoryBlock(b, count);
+		return b;
+	}
+
+	default:
+		isValid = false;
+		break;
+	}
+
+	return var();
+}
+
+String BinaryShowFile::Reader::readString(MemoryInputStream& s, int type)
+{
+	if (type == STRING_REF)
+	{
+		int index = s.readCompressedInt();
+		if (!isPositiveAndBelow(index, strings.size()))
+		{
+			isValid = false;
+			return String();
+		}
+		return strings[index];
+	}
+
+	String result;
+	if (type != STRING_VALUE || !readRawString(s, result))
+	{
+		isValid = false;
+		return String();
+	}
+
+	strings.add(result);
+	return result;
+}
+
+bool BinaryShowFile::Reader::readCount(MemoryInputStream& s, int& count, int minBytesPerElement)
+{
+	//checked against the remaining bytes so a corrupted count can't trigger a huge allocation
+	count = s.readCompressedInt();
+	if (count < 0 || (int64)count * minBytesPerElement > s.getNumBytesRemaining()) isValid = false;
+	return isValid;
+}
+
+//---------------
+
+bool BinaryShowFile::isBinaryShowFile(const File& f)
+{
+	std::unique_ptr<FileInputStream> is(f.createInputStream());
+	if (is == nullptr) return false;
+
+	char header[4];
+	return is->read(header, 4) == 4 && memcmp(header, binaryShowMagic, 4) == 0;
+}
+
+StringArray BinaryShowFile::getManagerChunkNames()
+{
+	StringArray result;
+	if (BluxEngine* be = dynamic_cast<BluxEngine*>(Engine::mainEngine))
+	{
+		for (auto& m : be->getShowManagers()) result.add(m->shortName);
+	}
+	return result;
+}
+
+bool BinaryShowFile::write(const var& data, const File& f)
+{
+	DynamicObject* o = data.getDynamicObject();
+	if (o == nullptr) return false;
+
+	const StringArray managerNames = getManagerChunkNames();
+
+	var engineData(new DynamicObject());
+	for (auto& p : o->getProperties())
+	{
+		if (!managerNames.contains(p.name.toString())) engineData.getDynamicObject()->setProperty(p.name, p.value);
+	}
+
+	TemporaryFile tf(f);
+	{
+		std::unique_ptr<FileOutputStream> os(tf.getFile().createOutputStream());
+		if (os == nullptr) return false;
+
+		Writer writer(os.get());
+		writer.writeChunk(engineChunkName, engineData);
+		for (auto& name : managerNames)
+		{
+			if (o->hasProperty(name)) writer.writeChunk(name, o->getProperty(name));
+		}
+		if (!writer.finish()) return false;
+	}
+
+	return tf.overwriteTargetFileWithTemporary();
+}
+
+var BinaryShowFile::read(const File& f)
+{
+	std::unique_ptr<FileInputStream> is(f.createInputStream());
+	Reader reader(is.get());
+	if (!reader.isValid) return var();
+
+	var data(new DynamicObject());
+	String name;
+	var chunkData;
+	while (reader.readNextChunk(name, chunkData))
+	{
+		if (name == engineChunkName && chunkData.isObject())
+		{
+			for (auto& p : chunkData.getDynamicObject()->getProperties()) data.getDynamicObject()->setProperty(p.name, p.value);
+		}
+		else
+		{
+			data.getDynamicObject()->setProperty(name, chunkData);
+		}
+	}
+
+	if (!reader.isValid) return var();
+	return data;
+}
+
+bool BinaryShowFile::isSameData(const var& a, const var& b)
+{
+	if (DynamicObject* oa = a.getDynamicObject())
+	{
+		DynamicObject* ob = b.getDynamicObject();
+		if (ob == nullptr || oa->getProperties().size() != ob->getProperties().size()) return false;
+		for (auto& p : oa->getProperties())
+		{
+			if (!ob->hasProperty(p.name) || !isSameData(p.value, ob->getProperty(p.name))) return false;
+		}
+		return true;
+	}
+
+	if (a.isArray())
+	{
+		if (!b.isArray() || a.size() != b.size()) return false;
+		for (int i = 0; i < a.size(); i++) if (!isSameData(a[i], b[i])) return false;
+		return true;
+	}
+
+	if (MemoryBlock* ba = a.getBinaryData()) return b.getBinaryData() != nullptr && *ba == *b.getBinaryData();
+
+	return a.hasSameTypeAs(b) && a == b;
+}
+
+bool BinaryShowFile::convertToJSON(const File& binaryFile, const File& jsonFile)
+{
+	var data = read(binaryFile);
+	if (!data.isObject()) return false;
+	return jsonFile.replaceWithText(JSON::toString(data));
+}
+
+bool BinaryShowFile::convertToBinary(const File& jsonFile, const File& binaryFile)
+{
+	var data = JSON::parse(jsonFile);
+	if (!data.isObject()) return false;
+	return write(data, binaryFile);
+}
@@ -0,0 +1,86 @@
+/*
+  ==============================================================================
+
+    BinaryShowFile.h
+    Created: 18 Oct 2026 4:12:37pm
+    Author:  bkupe
+
+  ==============================================================================
+*/
+
+#pragma once
+
+//Compact binary container for show data, lossless with the JSON format.
+//File layout : "BLXB", uint8 formatVersion, 3 reserved bytes, then a list of chunks (one per manager),
+//each one being uint8 marker (1 = chunk, 0 = end of file), string name, int32 payloadSize, payload.
+//Each chunk has its own string table so it can be decoded (or skipped) on its own : a string is written in full
+//the first time it is seen in the chunk and then referenced by index. Arrays of numbers sharing the same type
+//are written as typed arrays instead of one tagged value per element.
+class BinaryShowFile
+{
+public:
+    static const uint8 formatVersion = 1;
+
+    enum ValueType
+    {
+        VOID_VALUE, FALSE_VALUE, TRUE_VALUE, INT_VALUE, INT64_VALUE, DOUBLE_VALUE,
+        STRING_VALUE, STRING_REF, ARRAY_VALUE, OBJECT_VALUE,
+        INT_ARRAY, FLOAT_ARRAY, DOUBLE_ARRAY, BINARY_VALUE
+    };
+
+    class Writer
+    {
+    public:
+        Writer(OutputStream* out);
+        ~Writer() {}
+
+        OutputStream* out;
+        MemoryOutputStream chunkStream;
+        HashMap<String, int> stringIndices;
+        bool isValid;
+
+        //encodes and writes one chunk right away, so only one manager has to be held in memory at a time
+        bool writeChunk(const String& name, const var& data);
+        bool finish();
+
+        void writeValue(const var& v);
+        void writeString(const String& s);
+        bool writeTypedArray(const Array<var>& a);
+    };
+
+    class Reader
+    {
+    public:
+        Reader(InputStream* in);
+        ~Reader() {}
+
+        InputStream* in;
+        StringArray strings;
+        bool isValid;
+        bool isFinished;
+
+        //returns false at the end of the file or if the chunk is corrupted
+        bool readNextChunk(String& name, var& data);
+        bool skipNextChunk(String& name);
+
+        var readValue(MemoryInputStream& s);
+        String readString(MemoryInputStream& s, int type);
+        bool readCount(MemoryInputStream& s, int& count, int minBytesPerElement);
+    };
+
+    static bool isBinaryShowFile(const File& f);
+
+    //Whole show conversion, same layout as BluxEngine::saveBinaryShow : an "engine" chunk holding all the top level properties
+    //that are not show managers, then one chunk per show manager in load order. read() flattens it back to the .blux layout.
+    static const char* engineChunkName;
+    static StringArray getManagerChunkNames();
+
+    static bool write(const var& data, const File& f);
+    static var read(const File& f);
+
+    //deep comparison, object properties may be in any order
+    static bool isSameData(const var& a, const var& b);
+
+    static bool convertToJSON(const File& binaryFile, const File& jsonFile);
+    static bool convertToBinary(const File& jsonFile, const File& binaryFile);
+};
@@ -18,7 +18,8 @@
 #include "Common/CommonIncludes.h"
 
 BluxEngine::BluxEngine() :
-	Engine("Blux", ".blux")
+	Engine("Blux", ".blux"),
+	showResourcesPrefetched(false)
 {
 	mainEngine = this;
 	addChildControllableContainer(ObjectManager::getInstance());
@@ -40,22 +41,30 @@ BluxEngine::BluxEngine() :
 	breakingChangesVersions.add("1.2.0");
 
 	initVizServer();
+	vizStreamer.reset(new VizStreamer(this));
+	showJournal.reset(new ShowJournal(this));
+	effectChainWatcher.reset(new EffectChainWatcher(this));
 }
 
 BluxEngine::~BluxEngine()
 {
 	isClearing = true;
+	showJournal.reset();
+	effectChainWatcher.reset();
+	vizStreamer.reset();
+
 	ObjectManager::getInstance()->clear();
 	ObjectManager::deleteInstance();
+	ObjectLibrary::deleteInstance();
 	GroupManager::deleteInstance();
 	SceneManager::deleteInstance();
+	SceneDataStore::deleteInstance();
 	GlobalEffectManager::deleteInstance();
 	GlobalSequenceManager::deleteInstance();
 	StageLayoutManager::deleteInstance();
 	ColorSourceLibrary::deleteInstance();
 
-	TimedEffectHiResTimer::getInstance()->stopTimer();
-	TimedEffectHiResTimer::deleteInstance();
+	EngineClock::deleteInstance();
 
 	InterfaceManager::deleteInstance();
 	DMXManager::deleteInstance();
@@ -118,6 +127,12 @@ void BluxEngine::messageReceived(const String& id, const String& message)
 void BluxEngine::sendAllData(const String& id)
 {
 	var data = getVizData();
+	if (vizStreamer != nullptr && vizStreamer->isStreaming())
+	{
+		data.getDynamicObject()->setProperty("stream", vizStreamer->getTableData());
+		vizStreamer->requestKeyFrame();
+	}
+
 	var msgData(new DynamicObject());
 	msgData.getDynamicObject()->setProperty("type", "setup");
 	msgData.getDynamicObject()->setProperty("data", data);
@@ -129,6 +144,15 @@ void BluxEngine::sendControllableData(Controllable* c)
 	if (c->type == Controllable::TRIGGER) return;
 	Parameter* p = (Parameter*)c;
 
+	//computed values are sent in the binary frames when streaming
+	if (vizStreamer != nullptr && vizStreamer->isStreaming())
+	{
+		if (ObjectComponent* oc = dynamic_cast<ObjectComponent*>(p->parentContainer.get()))
+		{
+			if (oc->computedParameters.contains(p)) return;
+		}
+	}
+
 	var data(new DynamicObject());
 	data.getDynamicObject()->setProperty("controlAddress", p->getControlAddress(this));
 	data.getDynamicObject()->setProperty("value", p->getValue());
@@ -181,47 +205,194 @@ var BluxEngine::getJSONData()
 	var data = Engine::getJSONData();
 
 	//save here
-	data.getDynamicObject()->setProperty(ColorSourceLibrary::getInstance()->shortName, ColorSourceLibrary::getInstance()->getJSONData());
-	data.getDynamicObject()->setProperty(ObjectManager::getInstance()->shortName, ObjectManager::getInstance()->getJSONData());
-	data.getDynamicObject()->setProperty(InterfaceManager::getInstance()->shortName, InterfaceManager::getInstance()->getJSONData());
-	data.getDynamicObject()->setProperty(GroupManager::getInstance()->shortName, GroupManager::getInstance()->getJSONData());
-	data.getDynamicObject()->setProperty(SceneManager::getInstance()->shortName, SceneManager::getInstance()->getJSONData());
-	data.getDynamicObject()->setProperty(GlobalEffectManager::getInstance()->shortName, GlobalEffectManager::getInstance()->getJSONData());
-	data.getDynamicObject()->setProperty(GlobalSequenceManager::getInstance()->shortName, GlobalSequenceManager::getInstance()->getJSONData());
-	data.getDynamicObject()->setProperty(StageLayoutManager::getInstance()->shortName, StageLayoutManager::getInstance()->getJSONData());
+	for (auto& m : getShowManagers()) data.getDynamicObject()->setProperty(m->shortName, m->getJSONData());
 	return data;
 
 }
 
+Array<ControllableContainer*> BluxEngine::getShowManagers()
+{
+	//in load order, so binary show files can be loaded while they are read
+	Array<ControllableContainer*> result;
+	result.add(InterfaceManager::getInstance());
+	result.add(ColorSourceLibrary::getInstance());
+	result.add(ObjectManager::getInstance());
+	result.add(GroupManager::getInstance());
+	result.add(SceneManager::getInstance());
+	result.add(GlobalEffectManager::getInstance());
+	result.add(GlobalSequenceManager::getInstance());
+	result.add(StageLayoutManager::getInstance());
+	return result;
+}
+
+bool BluxEngine::saveBinaryShow(const File& f)
+{
+	double startTime = Time::getMillisecondCounterHiRes();
+
+	TemporaryFile tf(f);
+	{
+		std::unique_ptr<FileOutputStream> os(tf.getFile().createOutputStream());
+		if (os == nullptr)
+		{
+			NLOGERROR(niceName, "Could not write binary show file " << f.getFullPathName());
+			return false;
+		}
+
+		//each manager is serialized, written and released before the next one
+		BinaryShowFile::Writer writer(os.get());
+		writer.writeChunk(BinaryShowFile::engineChunkName, Engine::getJSONData());
+		for (auto& m : getShowManagers()) writer.writeChunk(m->shortName, m->getJSONData());
+
+		if (!writer.finish())
+		{
+			NLOGERROR(niceName, "Error writing binary show file " << f.getFullPathName());
+			return false;
+		}
+	}
+
+	if (!tf.overwriteTargetFileWithTemporary()) return false;
+
+	binaryShowFile = f;
+	NLOG(niceName, "Binary show saved to " << f.getFileName() << " in " << String((int)(Time::getMillisecondCounterHiRes() - startTime)) << " ms");
+	return true;
+}
+
+bool BluxEngine::loadBinaryShow(const File& f)
+{
+	if (isLoadingFile) return false;
+
+	std::unique_ptr<FileInputStream> is(f.createInputStream());
+	binaryReader.reset(new BinaryShowFile::Reader(is.get()));
+
+	String chunkName;
+	var engineData;
+	if (!binaryReader->isValid || !binaryReader->readNextChunk(chunkName, engineData) || chunkName != BinaryShowFile::engineChunkName || !engineData.isObject())
+	{
+		NLOGERROR(niceName, f.getFileName() << " is not a valid binary show file");
+		binaryReader.reset();
+		return false;
+	}
+
+	//manager chunks are pulled from the reader by loadJSONDataInternalEngine, as each one is needed
+	loadShowData(engineData, "Binary Show");
+
+	bool success = binaryReader->isValid;
+	binaryReader.reset();
+
+	if (success)
+	{
+		binaryShowFile = f;
+		if (showJournal != nullptr) showJournal->reset(f);
+	}
+	return success;
+}
+
+void BluxEngine::loadShowData(var data, const String& taskName)
+{
+	//same steps as a document load, for show data that doesn't come from a .blux file :
+	//the current show is cleared first, and listeners waiting for the end of the load are notified.
+	//Object resources are read before, while the current show is still running, so the compute thread
+	//is only stopped while the managers are cleared and rebuilt
+	prefetchShowResources(data);
+
+	clear();
+
+	isLoadingFile = true;
+	engineListeners.call(&EngineListener::startLoadFile);
+
+	ProgressTask task(taskName);
+	loadJSONData(data, &task);
+	showResourcesPrefetched = false; //in case the data was rejected before reaching the managers
+
+	isLoadingFile = false;
+	engineListeners.call(&EngineListener::endLoadFile);
+}
+
+void BluxEngine::prefetchShowResources(var data)
+{
+	const String objectsName = ObjectManager::getInstance()->shortName;
+	var objectsData = getShowData(data, objectsName);
+	if (data.isObject()) data.getDynamicObject()->setProperty(objectsName, objectsData); //a binary chunk is only read once
+
+	const double startTime = Time::getMillisecondCounterHiRes();
+	ObjectManager::getInstance()->prefetchResources(objectsData);
+	LOG("Loaded object resources in " << String((int)(Time::getMillisecondCounterHiRes() - startTime)) << " ms");
+
+	showResourcesPrefetched = true;
+}
+
+var BluxEngine::getShowData(var data, const String& name)
+{
+	if (data.hasProperty(name) || binaryReader == nullptr) return data.getProperty(name, var());
+
+	//streaming from a binary file, chunks before the requested one are kept for later
+	String chunkName;
+	var chunkData;
+	while (binaryReader->readNextChunk(chunkName, chunkData))
+	{
+		if (chunkName == name) return chunkData;
+		if (data.isObject()) data.getDynamicObject()->setProperty(chunkName, chunkData);
+	}
+
+	return var();
+}
+
 void BluxEngine::loadJSONDataInternalEngine(var data, ProgressTask* loadingTask)
 {
 	ProgressTask* bluxTask = loadingTask->addTask("Blux");
 
 	bluxTask->start();
 
-	InterfaceManager::getInstance()->loadJSONData(data.getProperty(InterfaceManager::getInstance()->shortName, var()));
-	bluxTask->setProgress(.1f);
+	const double loadStartTime = Time::getMillisecondCounterHiRes();
+	double stageStartTime = loadStartTime;
+	auto endStage = [&](const String& stageName, float progress)
+	{
+		double t = Time::getMillisecondCounterHiRes();
+		LOG("Loaded " << stageName << " in " << String((int)(t - stageStartTime)) << " ms");
+		stageStartTime = t;
+		bluxTask->setProgress(progress);
+	};
+
+	var objectsData = getShowData(data, ObjectManager::getInstance()->shortName);
+
+	//definitions and icons of all the object types in the file are read on worker threads before creating any object,
+	//loadShowData already did it before clearing the previous show
+	if (!showResourcesPrefetched)
+	{
+		ObjectManager::getInstance()->prefetchResources(objectsData);
+		endStage("object resources", .05f);
+	}
+	showResourcesPrefetched = false;
+
+	InterfaceManager::getInstance()->loadJSONData(getShowData(data, InterfaceManager::getInstance()->shortName));
+	endStage("interfaces", .1f);
+
+	ColorSourceLibrary::getInstance()->loadJSONData(getShowData(data, ColorSourceLibrary::getInstance()->shortName));
+	endStage("color source library", .15f);
+
+	ObjectManager::getInstance()->loadJSONData(objectsData);
+	endStage("objects", .2f);
 
-	ColorSourceLibrary::getInstance()->loadJSONData(data.getProperty(ColorSourceLibrary::getInstance()->shortName, var()));
-	bluxTask->setProgress(.15f);
+	//cross references between objects and interfaces are resolved once everything they point to exists
+	ObjectManager::getInstance()->resolveInterfaceParams();
+	endStage("object interface parameters", .25f);
 
-	ObjectManager::getInstance()->loadJSONData(data.getProperty(ObjectManager::getInstance()->shortName, var()));
-	bluxTask->setProgress(.2f);
+	GroupManager::getInstance()->loadJSONData(getShowData(data, GroupManager::getInstance()->shortName));
+	endStage("groups", .3f);
 
-	GroupManager::getInstance()->loadJSONData(data.getProperty(GroupManager::getInstance()->shortName, var()));
-	bluxTask->setProgress(.3f);
+	SceneManager::getInstance()->loadJSONData(getShowData(data, SceneManager::getInstance()->shortName));
+	endStage("scenes", .4f);
 
-	SceneManager::getInstance()->loadJSONData(data.getProperty(SceneManager::getInstance()->shortName, var()));
-	bluxTask->setProgress(.4f);
+	GlobalEffectManager::getInstance()->loadJSONData(getShowData(data, GlobalEffectManager::getInstance()->shortName));
+	endStage("global effects", .5f);
 
-	GlobalEffectManager::getInstance()->loadJSONData(data.getProperty(GlobalEffectManager::getInstance()->shortName, var()));
-	bluxTask->setProgress(.5f);
+	GlobalSequenceManager::getInstance()->loadJSONData(getShowData(data, GlobalSequenceManager::getInstance()->shortName));
+	endStage("sequences", .6f);
 
-	GlobalSequenceManager::getInstance()->loadJSONData(data.getProperty(GlobalSequenceManager::getInstance()->shortName, var()));
-	bluxTask->setProgress(.6f);
+	StageLayoutManager::getInstance()->loadJSONData(getShowData(data, StageLayoutManager::getInstance()->shortName));
+	endStage("layouts", 1);
 
-	StageLayoutManager::getInstance()->loadJSONData(data.getProperty(StageLayoutManager::getInstance()->shortName, var()));
-	bluxTask->setProgress(1);
+	LOG("Show loaded in " << String((int)(Time::getMillisecondCounterHiRes() - loadStartTime)) << " ms");
 
 	bluxTask->end();
 }
@@ -233,8 +404,28 @@ BluxSettings::BluxSettings() :
 {
 	defaultSceneLoadTime = addFloatParameter("Default Scene Load Time", "The default load time to set the scenes to on creation", 1, 0);
 	defaultSceneLoadTime->defaultUI = FloatParameter::TIME;
+
+	vizBinaryStream = addBoolParameter("Viz Binary Stream", "If checked, the computed values of all objects are sent to the visualizer as one binary message per frame instead of one JSON message per parameter change", false);
+	vizStreamFPS = addIntParameter("Viz Stream FPS", "Maximum number of frames sent to the visualizer per second when binary streaming is enabled", 30, 1, 120);
+	vizDeltaEncoding = addBoolParameter("Viz Delta Encoding", "If checked, only values that changed since the previous frame are sent, with a full frame when a client connects or objects change", true);
+
+	autosaveJournal = addBoolParameter("Autosave Journal", "If checked, changes are continuously written to an autosave journal in the background, so they can be recovered if Blux doesn't close properly", true);
+	autosaveSnapshotInterval = addIntParameter("Autosave Snapshot Interval", "Interval in minutes at which the autosave journal is compacted into a full snapshot of the show", 5, 1, 60);
+
+	clockMode = addEnumParameter("Clock Mode", "Real Time uses the system clock. Virtual steps the engine time by exactly 1 / Virtual Clock Rate at each update, so the output is reproducible and doesn't depend on how fast it is computed");
+	clockMode->addOption("Real Time", EngineClock::REAL_TIME)->addOption("Virtual", EngineClock::VIRTUAL);
+	virtualClockRate = addIntParameter("Virtual Clock Rate", "Number of updates per second of engine time in virtual mode", 50, 1, 1000);
+	virtualClockFreeRun = addBoolParameter("Virtual Clock Free Run", "If checked, updates are computed as fast as possible in virtual mode instead of being paced in real time, for benchmarks", false);
 }
 
 BluxSettings::~BluxSettings()
 {
 }
+
+void BluxSettings::onContainerParameterChanged(Parameter* p)
+{
+	if (p == clockMode || p == virtualClockRate || p == virtualClockFreeRun)
+	{
+		EngineClock::getInstance()->setMode(clockMode->getValueDataAsEnum<EngineClock::ClockMode>(), virtualClockRate->intValue(), virtualClockFreeRun->boolValue());
+	}
+}
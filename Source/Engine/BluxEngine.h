@@ -11,6 +11,10 @@
 #pragma once
 #include "JuceHeader.h"
 
+class VizStreamer;
+class ShowJournal;
+class EffectChainWatcher;
+
 class BluxEngine : public Engine,
     public SimpleWebSocketServer::Listener
 {
@@ -19,8 +23,12 @@ public:
     ~BluxEngine();
 
     std::unique_ptr<SimpleWebSocketServer> vizServer;
+    std::unique_ptr<VizStreamer> vizStreamer;
     void initVizServer();
 
+    std::unique_ptr<ShowJournal> showJournal;
+    std::unique_ptr<EffectChainWatcher> effectChainWatcher;
+
     void connectionOpened(const String& id);
     void messageReceived(const String& id, const String& message);
 
@@ -30,6 +38,20 @@ public:
 
     var getVizData();
 
+    //binary show files, read one manager chunk at a time while loading
+    std::unique_ptr<BinaryShowFile::Reader> binaryReader;
+    File binaryShowFile;
+
+    Array<ControllableContainer*> getShowManagers();
+    bool saveBinaryShow(const File& f);
+    bool loadBinaryShow(const File& f);
+    void loadShowData(var data, const String& taskName);
+    var getShowData(var data, const String& name);
+
+    //work of a load that doesn't touch the current show, done before it is cleared
+    bool showResourcesPrefetched;
+    void prefetchShowResources(var data);
+
     void onControllableFeedbackUpdate(ControllableContainer* cc, Controllable* c) override;
     void clearInternal() override;
 
@@ -49,4 +71,17 @@ public:
     ~BluxSettings();
 
     FloatParameter * defaultSceneLoadTime;
+
+    BoolParameter* vizBinaryStream;
+    IntParameter* vizStreamFPS;
+    BoolParameter* vizDeltaEncoding;
+
+    BoolParameter* autosaveJournal;
+    IntParameter* autosaveSnapshotInterval;
+
+    EnumParameter* clockMode;
+    IntParameter* virtualClockRate;
+    BoolParameter* virtualClockFreeRun;
+
+    void onContainerParameterChanged(Parameter* p) override;
 };
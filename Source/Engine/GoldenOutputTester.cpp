@@ -0,0 +1,288 @@
+/*
+  ==============================================================================
+
+    GoldenOutputTester.cpp
+    Created: 18 Oct 2026 7:34:52pm
+    Author:  bkupe
+
+  ==============================================================================
+*/
+
+GoldenOutputTester::GoldenOutputTester(const File& folder) :
+	folder(folder),
+	numTicks(250),
+	fps(50),
+	tolerance(0),
+	updateGolden(false)
+{
+}
+
+int GoldenOutputTester::runAll()
+{
+	report.clear();
+
+	Array<File> showFiles = folder.findChildFiles(File::findFiles, false, "*.blux;*.bluxb");
+	showFiles.sort();
+
+	if (showFiles.isEmpty())
+	{
+		addReport("No show files found in " + folder.getFullPathName());
+		return 1;
+	}
+
+	addReport("Golden output test : " + String(showFiles.size()) + " fixtures, " + String(numTicks) + " ticks at " + String(fps) + " fps, tolerance " + String(tolerance));
+
+	int numFailed = 0;
+	for (auto& f : showFiles)
+	{
+		if (!runFixture(f)) numFailed++;
+	}
+
+	addReport(String(showFiles.size() - numFailed) + " passed, " + String(numFailed) + " failed");
+	folder.getChildFile("golden-report.txt").replaceWithText(report.joinIntoString("\n") + "\n");
+
+	return numFailed;
+}
+
+bool GoldenOutputTester::runFixture(const File& showFile)
+{
+	const String name = showFile.getFileNameWithoutExtension();
+
+	if (!BinaryShowFile::isBinaryShowFile(showFile) && !checkBinaryRoundTrip(showFile))
+	{
+		addReport("[FAIL] " + name + " : the binary conversion doesn't give back the same show data");
+		return false;
+	}
+
+	if (!loadShow(showFile))
+	{
+		addReport("[FAIL] " + name + " : could not load the show");
+		return false;
+	}
+
+	OfflineRenderer::Settings s;
+	for (auto& i : InterfaceManager::getInstance()->items)
+	{
+		if (DMXInterface* di = dynamic_cast<DMXInterface*>(i))
+		{
+			s.dmxInterface = di;
+			break;
+		}
+	}
+
+	if (s.dmxInterface == nullptr)
+	{
+		addReport("[FAIL] " + name + " : no DMX interface to compare");
+		return false;
+	}
+
+	GlobalSequenceManager* gsm = GlobalSequenceManager::getInstance();
+	s.sequence = gsm->items.size() > 0 ? gsm->items[0] : nullptr;
+	s.fps = fps;
+	s.duration = (numTicks - 1) / (float)fps;
+	s.resetClock = true;
+
+	File goldenFile = showFile.getSiblingFile(name + ".golden.rawdata");
+	s.file = updateGolden ? goldenFile : File::getSpecialLocation(File::tempDirectory).getChildFile(name + ".result.rawdata");
+
+	OfflineRenderer renderer;
+	renderer.settings = s;
+	if (!renderer.render())
+	{
+		addReport("[FAIL] " + name + " : render failed");
+		return false;
+	}
+
+	if (updateGolden)
+	{
+		addReport("[GOLDEN] " + name + " : recorded " + goldenFile.getFileName());
+		return true;
+	}
+
+	//a fixture without its golden file is not tested, it must not pass silently
+	if (!goldenFile.existsAsFile())
+	{
+		addReport("[FAIL] " + name + " : missing golden " + goldenFile.getFileName() + ", result kept in " + s.file.getFullPathName()
+			+ ", run with --update-golden to record it");
+		return false;
+	}
+
+	bool result = compare(goldenFile, s.file);
+	if (result) s.file.deleteFile(); //failed results are kept to be inspected or promoted to golden
+	return result;
+}
+
+bool GoldenOutputTester::loadShow(const File& showFile)
+{
+	BluxEngine* be = (BluxEngine*)Engine::mainEngine;
+	if (BinaryShowFile::isBinaryShowFile(showFile)) return be->loadBinaryShow(showFile);
+
+	var data = JSON::parse(showFile);
+	if (!data.isObject()) return false;
+
+	be->loadShowData(data, "Golden Test");
+	return true;
+}
+
+bool GoldenOutputTester::checkBinaryRoundTrip(const File& showFile)
+{
+	//.blux -> .bluxb -> .blux must give back the same data
+	var data = JSON::parse(showFile);
+	if (!data.isObject()) return false;
+
+	TemporaryFile tf(".bluxb");
+	return BinaryShowFile::write(data, tf.getFile()) && BinaryShowFile::isSameData(data, BinaryShowFile::read(tf.getFile()));
+}
+
+bool GoldenOutputTester::compare(const File& goldenFile, const File& resultFile)
+{
+	const String name = goldenFile.getFileName().upToFirstOccurrenceOf(".", false, false);
+
+	OwnedArray<Frame> goldenFrames;
+	OwnedArray<Frame> resultFrames;
+	if (!readFrames(goldenFile, goldenFrames) || !readFrames(resultFile, resultFrames))
+	{
+		addReport("[FAIL] " + name + " : could not read the recordings");
+		return false;
+	}
+
+	//recordings only store the universes that changed, so the full state is rebuilt and compared at each tick
+	HashMap<int, MemoryBlock> goldenState;
+	HashMap<int, MemoryBlock> resultState;
+	int goldenIndex = 0;
+	int resultIndex = 0;
+
+	auto applyFrames = [](OwnedArray<Frame>& frames, int& index, float time, HashMap<int, MemoryBlock>& state)
+	{
+		while (index < frames.size() && frames[index]->time <= time)
+		{
+			Frame* f = frames[index];
+			for (int i = 0; i < f->universeIndices.size(); i++)
+			{
+				state.set(f->universeIndices[i], MemoryBlock(addBytesToPointer(f->values.getData(), i * DMX_NUM_CHANNELS), DMX_NUM_CHANNELS));
+			}
+			index++;
+		}
+	};
+
+	int numDiffs = 0;
+	int maxDiff = 0;
+	int numDiffTicks = 0;
+	const MemoryBlock emptyUniverse(DMX_NUM_CHANNELS, true);
+
+	for (int tick = 0; tick < numTicks; tick++)
+	{
+		const float time = (tick + .5f) / fps; //frame times are written as floats, half a tick of margin
+		applyFrames(goldenFrames, goldenIndex, time, goldenState);
+		applyFrames(resultFrames, resultIndex, time, resultState);
+
+		Array<int> indices;
+		for (HashMap<int, MemoryBlock>::Iterator it(goldenState); it.next();) indices.addIfNotAlreadyThere(it.getKey());
+		for (HashMap<int, MemoryBlock>::Iterator it(resultState); it.next();) indices.addIfNotAlreadyThere(it.getKey());
+		indices.sort();
+
+		bool tickHasDiff = false;
+		for (auto& index : indices)
+		{
+			const MemoryBlock& g = goldenState.contains(index) ? goldenState.getReference(index) : emptyUniverse;
+			const MemoryBlock& r = resultState.contains(index) ? resultState.getReference(index) : emptyUniverse;
+
+			for (int c = 0; c < DMX_NUM_CHANNELS; c++)
+			{
+				const int diff = std::abs((int)(uint8)g[c] - (int)(uint8)r[c]);
+				if (diff <= tolerance) continue;
+
+				if (numDiffs < maxReportedDiffs)
+				{
+					addReport("    tick " + String(tick) + ", universe " + String(index) + ", channel " + String(c + 1)
+						+ " : expected " + String((int)(uint8)g[c]) + ", got " + String((int)(uint8)r[c]));
+				}
+
+				numDiffs++;
+				maxDiff = jmax(maxDiff, diff);
+				tickHasDiff = true;
+			}
+		}
+
+		if (tickHasDiff) numDiffTicks++;
+	}
+
+	if (numDiffs == 0)
+	{
+		addReport("[PASS] " + name);
+		return true;
+	}
+
+	addReport("[FAIL] " + name + " : " + String(numDiffs) + " channel differences on " + String(numDiffTicks) + " ticks, max difference " + String(maxDiff)
+		+ ", result kept in " + resultFile.getFullPathName());
+	return false;
+}
+
+void GoldenOutputTester::addReport(const String& line)
+{
+	report.add(line);
+	NLOG("Golden Test", line);
+	std::cout << line << std::endl;
+}
+
+bool GoldenOutputTester::readFrames(const File& f, OwnedArray<Frame>& frames)
+{
+	FileInputStream fs(f);
+	if (fs.failedToOpen()) return false;
+
+	const int headerSize = 12; //totalTime, total Num Universes, num written frames
+	const int frameHeaderSize = 12; //frameSize, time, num universes
+	if (fs.getTotalLength() < headerSize) return false;
+	fs.setPosition(headerSize);
+
+	//a truncated recording must fail, not compare a partially filled universe
+	while (fs.getNumBytesRemaining() > 0)
+	{
+		if (fs.getNumBytesRemaining() < frameHeaderSize) return false;
+
+		const int frameSize = fs.readInt();
+		std::unique_ptr<Frame> frame(new Frame());
+		frame->time = fs.readFloat();
+		const int numUniverses = fs.readInt();
+		if (numUniverses < 0 || frameSize != numUniverses * (DMX_NUM_CHANNELS + 4)) return false;
+		if (fs.getNumBytesRemaining() < frameSize) return false;
+
+		frame->values.setSize(numUniverses * DMX_NUM_CHANNELS);
+		for (int i = 0; i < numUniverses; i++)
+		{
+			frame->universeIndices.add(fs.readInt());
+			if (fs.read(addBytesToPointer(frame->values.getData(), i * DMX_NUM_CHANNELS), DMX_NUM_CHANNELS) != DMX_NUM_CHANNELS) return false;
+		}
+
+		frames.add(frame.release());
+	}
+
+	return true;
+}
+
+bool GoldenOutputTester::isGoldenTestCommandLine(const String& commandLine)
+{
+	return StringArray::fromTokens(commandLine, true).contains("--golden-test");
+}
+
+int GoldenOutputTester::runFromCommandLine(const String& commandLine)
+{
+	StringArray args = StringArray::fromTokens(commandLine, true);
+	for (auto& a : args) a = a.unquoted();
+
+	const int folderIndex = args.indexOf("--golden-test") + 1;
+	File folder = File::getCurrentWorkingDirectory().getChildFile(args[folderIndex]);
+	if (folderIndex >= args.size() || !folder.isDirectory())
+	{
+		std::cout << "Usage : --golden-test <folder> [--ticks N] [--fps F] [--tolerance T] [--update-golden]" << std::endl;
+		return 1;
+	}
+
+	GoldenOutputTester tester(folder);
+	if (args.contains("--ticks")) tester.numTicks = jmax(args[args.indexOf("--ticks") + 1].getIntValue(), 1);
+	if (args.contains("--fps")) tester.fps = jmax(args[args.indexOf("--fps") + 1].getIntValue(), 1);
+	if (args.contains("--tolerance")) tester.tolerance = jmax(args[args.indexOf("--tolerance") + 1].getIntValue(), 0);
+	tester.updateGolden = args.contains("--update-golden");
+
+	return tester.runAll();
+}
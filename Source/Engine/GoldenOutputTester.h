@@ -0,0 +1,52 @@
+/*
+  ==============================================================================
+
+    GoldenOutputTester.h
+    Created: 18 Oct 2026 7:34:52pm
+    Author:  bkupe
+
+  ==============================================================================
+*/
+
+#pragma once
+
+//Regression check of the compute chain : each show file of a fixture folder is loaded, rendered offline from a reset
+//clock for a number of ticks and the universes of its first DMX interface are compared channel by channel with the
+//golden recording stored next to it (show.golden.rawdata). A missing golden file fails, unless --update-golden is given.
+//Run with : Blux --golden-test <folder> [--ticks N] [--fps F] [--tolerance T] [--update-golden]
+class GoldenOutputTester
+{
+public:
+    GoldenOutputTester(const File& folder);
+    ~GoldenOutputTester() {}
+
+    File folder;
+    int numTicks;
+    int fps;
+    int tolerance; //max difference per channel, in DMX steps
+    bool updateGolden;
+
+    static const int maxReportedDiffs = 20; //per fixture, the total count is always reported
+
+    StringArray report;
+
+    struct Frame
+    {
+        float time = 0;
+        Array<int> universeIndices;
+        MemoryBlock values; //DMX_NUM_CHANNELS bytes per universe, in universeIndices order
+    };
+
+    //returns the number of fixtures that don't match their golden output
+    int runAll();
+    bool runFixture(const File& showFile);
+    bool loadShow(const File& showFile);
+    bool checkBinaryRoundTrip(const File& showFile);
+    bool compare(const File& goldenFile, const File& resultFile);
+
+    void addReport(const String& line);
+
+    static bool readFrames(const File& f, OwnedArray<Frame>& frames);
+    static bool isGoldenTestCommandLine(const String& commandLine);
+    static int runFromCommandLine(const String& commandLine);
+};
@@ -0,0 +1,179 @@
+/*
+  ==============================================================================
+
+    OfflineRenderer.cpp
+    Created: 18 Oct 2026 6:21:14pm
+    Author:  bkupe
+
+  ==============================================================================
+*/
+
+OfflineRenderer::OfflineRenderer() :
+	Thread("Offline Renderer"),
+	progress(0),
+	success(false),
+	numWrittenFrames(0),
+	numUniverses(0)
+{
+}
+
+OfflineRenderer::~OfflineRenderer()
+{
+	stopThread(5000);
+}
+
+void OfflineRenderer::start(const Settings& s)
+{
+	stopThread(5000);
+	settings = s;
+	startThread();
+}
+
+bool OfflineRenderer::render()
+{
+	progress = 0;
+	numWrittenFrames = 0;
+	numUniverses = 0;
+
+	if (settings.dmxInterface == nullptr || settings.fps <= 0 || settings.duration <= 0)
+	{
+		LOGERROR("Offline render needs a DMX interface, a duration and a frame rate");
+		return false;
+	}
+
+	settings.file.getParentDirectory().createDirectory();
+	if (settings.file.existsAsFile()) settings.file.deleteFile();
+
+	std::unique_ptr<FileOutputStream> output(new FileOutputStream(settings.file));
+	if (output->failedToOpen())
+	{
+		LOGERROR("Could not open " << settings.file.getFullPathName() << " for offline render");
+		return false;
+	}
+
+	//reserve space for metadata, same layout as RawDataLayer recordings
+	output->writeFloat(0); //totalTime
+	output->writeInt(0); //total Num Universes
+	output->writeInt(0); //num written frames
+
+	ObjectManager* om = ObjectManager::getInstance();
+	SceneManager* sm = SceneManager::getInstance();
+	EngineClock* clock = EngineClock::getInstance();
+
+	const bool wasComputing = om->isThreadRunning();
+	om->stopThread(1000);
+	om->offlineThreadID = Thread::getCurrentThreadId();
+
+	if (settings.sequence != nullptr && settings.sequence->isPlaying->boolValue()) settings.sequence->pauseTrigger->trigger();
+
+	const double renderStartTime = Time::getMillisecondCounterHiRes();
+	const int previousTickRate = clock->tickRate;
+	clock->tickRate = settings.fps;
+	if (settings.resetClock) clock->reset(0);
+	const double clockStart = clock->tickTime;
+	clock->tick(clockStart);
+
+	sm->steppedTransitions = true;
+	if (settings.scene != nullptr) sm->loadScene(settings.scene, settings.sceneLoadTime, false);
+
+	OwnedArray<DMXUniverse> lastUniverses;
+	HashMap<int, DMXUniverse*> lastUniverseMap;
+
+	const int numFrames = roundToInt(settings.duration * settings.fps) + 1;
+	bool aborted = false;
+	for (int i = 0; i < numFrames; i++)
+	{
+		if (Thread::currentThreadShouldExit())
+		{
+			aborted = true;
+			break;
+		}
+
+		const double t = i / (double)settings.fps;
+		clock->tick(clockStart + t); //also steps the scene transition
+
+		if (settings.sequence != nullptr) settings.sequence->setCurrentTime(settings.startTime + t, true, false);
+
+		om->computeFrame(false);
+		writeFrame(*output, (float)t, lastUniverses, lastUniverseMap);
+
+		progress = (i + 1) / (float)numFrames;
+	}
+
+	if (sm->transitionRunning)
+	{
+		GenericScopedLock lock(sm->transitionLock);
+		sm->endTransition();
+	}
+	sm->steppedTransitions = false;
+
+	om->offlineThreadID = nullptr;
+	clock->tickRate = previousTickRate;
+	clock->resumeRealTime();
+	if (wasComputing) om->startThread();
+
+	numUniverses = lastUniverses.size();
+	output->setPosition(0);
+	output->writeFloat((numFrames - 1) / (float)settings.fps); //totalTime
+	output->writeInt(numUniverses); //total Num Universes
+	output->writeInt(numWrittenFrames); //num written frames
+	output->flush();
+	output.reset();
+
+	if (aborted)
+	{
+		LOGWARNING("Offline render aborted");
+		settings.file.deleteFile();
+		return false;
+	}
+
+	LOG("Rendered " << numFrames << " frames (" << numUniverses << " universes) to " << settings.file.getFullPathName()
+		<< " in " << String((int)(Time::getMillisecondCounterHiRes() - renderStartTime)) << " ms");
+
+	return true;
+}
+
+void OfflineRenderer::writeFrame(OutputStream& os, float time, OwnedArray<DMXUniverse>& lastUniverses, HashMap<int, DMXUniverse*>& lastUniverseMap)
+{
+	int numFrameUniverses = 0;
+	MemoryBlock b;
+	MemoryOutputStream ms(b, false);
+
+	//only the universes that changed since the last written frame, the first frame has them all
+	for (auto& u : settings.dmxInterface->universes)
+	{
+		const int index = DMXUniverse::getUniverseIndex(u->net, u->subnet, u->universe);
+
+		DMXUniverse* lu = lastUniverseMap.contains(index) ? lastUniverseMap[index] : nullptr;
+		if (lu == nullptr)
+		{
+			lu = new DMXUniverse(u->net, u->subnet, u->universe);
+			lastUniverses.add(lu);
+			lastUniverseMap.set(index, lu);
+		}
+		else if (memcmp(lu->values.getRawDataPointer(), u->values.getRawDataPointer(), DMX_NUM_CHANNELS) == 0) continue;
+
+		lu->values = u->values;
+
+		ms.writeInt(index);
+		ms.write(u->values.getRawDataPointer(), DMX_NUM_CHANNELS);
+		numFrameUniverses++;
+	}
+
+	ms.flush();
+
+	if (numFrameUniverses == 0) return;
+
+	os.writeInt((int)b.getSize());
+	os.writeFloat(time);
+	os.writeInt(numFrameUniverses);
+	os.write(b.getData(), b.getSize());
+
+	numWrittenFrames++;
+}
+
+void OfflineRenderer::run()
+{
+	success = render();
+	if (onFinished != nullptr) onFinished(this);
+}
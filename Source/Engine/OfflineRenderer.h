@@ -0,0 +1,54 @@
+/*
+  ==============================================================================
+
+    OfflineRenderer.h
+    Created: 18 Oct 2026 6:21:14pm
+    Author:  bkupe
+
+  ==============================================================================
+*/
+
+#pragma once
+
+class DMXInterface;
+class Scene;
+
+//Runs the whole compute chain (scene transition, sequence, objects and effects) frame by frame from a virtual clock,
+//as fast as possible instead of in real time, and writes the universes of a DMX interface to a .rawdata file.
+//The compute thread is paused while rendering and the values are not sent to the devices.
+class OfflineRenderer :
+    public Thread
+{
+public:
+    OfflineRenderer();
+    ~OfflineRenderer();
+
+    struct Settings
+    {
+        DMXInterface* dmxInterface = nullptr;
+        Sequence* sequence = nullptr; //optional, its time is set at each frame
+        Scene* scene = nullptr; //optional, loaded at the beginning of the render
+        float sceneLoadTime = -1;
+        float startTime = 0;
+        float duration = 10;
+        int fps = 50;
+        File file;
+        bool resetClock = false; //start from time 0 with fresh time references, so renders of the same show are identical
+    };
+
+    Settings settings;
+    std::atomic<float> progress;
+    bool success;
+    int numWrittenFrames;
+    int numUniverses;
+
+    std::function<void(OfflineRenderer*)> onFinished; //called from the render thread
+
+    void start(const Settings& s);
+
+    //renders on the calling thread
+    bool render();
+    void writeFrame(OutputStream& os, float time, OwnedArray<DMXUniverse>& lastUniverses, HashMap<int, DMXUniverse*>& lastUniverseMap);
+
+    void run() override;
+};
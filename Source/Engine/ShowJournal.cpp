@@ -0,0 +1,761 @@
+/*
+  ==============================================================================
+
+    ShowJournal.cpp
+    Created: 18 Oct 2026 5:03:48pm
+    Author:  bkupe
+
+  ==============================================================================
+*/
+
+ShowJournal::ShowJournal(BluxEngine* engine) :
+	Thread("Show Journal"),
+	engine(engine),
+	resetRequested(false),
+	rotateRequested(false),
+	snapshotReady(false),
+	journalBytes(0),
+	lastSnapshotTime(Time::getMillisecondCounter()),
+	rotationIndex(0),
+	waitingForSnapshot(false),
+	snapshotRequested(false),
+	itemListener(this),
+	lastStructureCheckTime(0),
+	isReplaying(false)
+{
+	autosaveFolder = File::getSpecialLocation(File::userApplicationDataDirectory).getChildFile(String(ProjectInfo::projectName) + "/autosave");
+	sessionFolder = autosaveFolder.getChildFile(String(Time::currentTimeMillis()));
+	sessionFolder.createDirectory();
+	sessionLock.reset(new InterProcessLock(getSessionLockName(sessionFolder)));
+	sessionLock->enter(0);
+	journalFile = sessionFolder.getChildFile("journal.log");
+
+	managers = engine->getShowManagers();
+	for (auto& m : managers)
+	{
+		m->addControllableContainerListener(this);
+		managerItems.add(new ManagerItems());
+	}
+	engine->addEngineListener(this);
+
+	pruneSessionFolders();
+	if (hasRecovery()) NLOGWARNING("Autosave", "The previous session was not closed properly, its last changes can be recovered from the File menu");
+
+	reset(File());
+	startThread();
+	startTimer(100);
+}
+
+ShowJournal::~ShowJournal()
+{
+	stopTimer();
+	engine->removeEngineListener(this);
+	for (auto& m : managers) m->removeControllableContainerListener(this);
+	for (auto& known : managerItems)
+	{
+		for (auto& item : known->items) if (item != nullptr) item->removeControllableContainerListener(&itemListener);
+	}
+
+	stopThread(2000);
+	journalStream.reset();
+
+	//clean exit, nothing to recover from this session
+	sessionFolder.deleteRecursively();
+	sessionLock.reset();
+}
+
+bool ShowJournal::isEnabled() const
+{
+	return BluxSettings::getInstance()->autosaveJournal->boolValue();
+}
+
+bool ShowJournal::shouldRecord() const
+{
+	return isEnabled() && !isReplaying && !engine->isLoadingFile && !engine->isClearing;
+}
+
+void ShowJournal::reset(const File& baseline, const var& baselineData)
+{
+	snapshotQueue.clear();
+	snapshotChunks = var();
+	resetManagerItems();
+
+	{
+		GenericScopedLock lock(pendingLock);
+		dirtyManagers.clear();
+		dirtyItems.clear();
+		pendingEntries.clearQuick();
+		pendingValueIndices.clear();
+		preRotationEntries.clearQuick();
+		rotateRequested = false;
+		snapshotReady = false;
+		snapshotData = var();
+
+		resetRequested = true;
+		resetBaseline = baseline.existsAsFile() ? baseline.getFullPathName() : String();
+		resetBaselineData = baseline.existsAsFile() ? var() : baselineData;
+	}
+
+	//nothing on disk or in memory matches the current show, so the journal needs a snapshot of the live show to start from
+	snapshotRequested = !baseline.existsAsFile() && !baselineData.isObject();
+}
+
+void ShowJournal::requestSnapshot()
+{
+	snapshotRequested = true;
+}
+
+void ShowJournal::addEntry(const var& entry, const String& valueAddress)
+{
+	GenericScopedLock lock(pendingLock);
+
+	if (valueAddress.isNotEmpty())
+	{
+		if (pendingValueIndices.contains(valueAddress))
+		{
+			pendingEntries.set(pendingValueIndices[valueAddress], entry);
+			return;
+		}
+
+		pendingValueIndices.set(valueAddress, pendingEntries.size());
+	}
+
+	pendingEntries.add(entry);
+}
+
+Array<ControllableContainer*> ShowJournal::getItems(ControllableContainer* manager)
+{
+	Array<ControllableContainer*> result;
+	for (auto& cc : manager->controllableContainers)
+	{
+		if (dynamic_cast<BaseItem*>(cc.get()) != nullptr) result.add(cc.get());
+	}
+	return result;
+}
+
+void ShowJournal::resetManagerItems()
+{
+	for (int i = 0; i < managers.size(); i++)
+	{
+		ManagerItems* known = managerItems[i];
+		for (auto& item : known->items) if (item != nullptr) item->removeControllableContainerListener(&itemListener);
+		known->items.clearQuick();
+		known->names.clearQuick();
+
+		for (auto& item : getItems(managers[i]))
+		{
+			item->addControllableContainerListener(&itemListener);
+			known->items.add(item);
+			known->names.add(item->niceName);
+		}
+	}
+}
+
+void ShowJournal::addStructureEntries(int managerIndex)
+{
+	//only the items that changed since the last check are serialized, never the whole manager
+	ControllableContainer* m = managers[managerIndex];
+	ManagerItems* known = managerItems[managerIndex];
+	Array<ControllableContainer*> items = getItems(m);
+
+	Array<WeakReference<ControllableContainer>> changedItems;
+	{
+		GenericScopedLock lock(pendingLock);
+		for (auto& item : items)
+		{
+			if (!dirtyItems.contains(item)) continue;
+			dirtyItems.removeAllInstancesOf(item);
+			changedItems.add(item);
+		}
+
+		for (int i = dirtyItems.size() - 1; i >= 0; i--) if (dirtyItems[i] == nullptr) dirtyItems.remove(i);
+	}
+
+	auto addManagerEntry = [this, m](const String& key, const var& value, const String& otherKey = String(), const var& otherValue = var())
+	{
+		var entry(new DynamicObject());
+		entry.getDynamicObject()->setProperty("m", m->shortName);
+		entry.getDynamicObject()->setProperty(key, value);
+		if (otherKey.isNotEmpty()) entry.getDynamicObject()->setProperty(otherKey, otherValue);
+		addEntry(entry);
+	};
+
+	//the order the replayed entries will give, to know if a reorder has to be journaled as well
+	StringArray expectedNames;
+
+	for (int i = 0; i < known->items.size(); i++)
+	{
+		ControllableContainer* item = known->items[i].get();
+		if (item == nullptr || !items.contains(item))
+		{
+			if (item != nullptr) item->removeControllableContainerListener(&itemListener);
+			addManagerEntry("rm", known->names[i]);
+			continue;
+		}
+
+		if (item->niceName != known->names[i]) addManagerEntry("rn", known->names[i], "n", item->niceName);
+		expectedNames.add(item->niceName);
+	}
+
+	StringArray names;
+	for (int i = 0; i < items.size(); i++)
+	{
+		ControllableContainer* item = items[i];
+		names.add(item->niceName);
+
+		if (known->items.contains(item))
+		{
+			//replaces the item data of the same name
+			if (changedItems.contains(item)) addManagerEntry("add", item->getJSONData(), "i", i);
+			continue;
+		}
+
+		item->addControllableContainerListener(&itemListener);
+		addManagerEntry("add", item->getJSONData(), "i", i);
+		expectedNames.insert(i, item->niceName);
+	}
+
+	if (names != expectedNames)
+	{
+		var order;
+		for (auto& n : names) order.append(n);
+		addManagerEntry("order", order);
+	}
+
+	known->items.clearQuick();
+	known->items.addArray(items);
+	known->names = names;
+}
+
+void ShowJournal::applyStructureEntry(var data, const var& entry)
+{
+	const String managerName = entry["m"].toString();
+	var managerData = data.getProperty(managerName, var());
+	if (!managerData.isObject())
+	{
+		managerData = var(new DynamicObject());
+		data.getDynamicObject()->setProperty(managerName, managerData);
+	}
+
+	Array<var> items;
+	if (managerData["items"].isArray()) items = *managerData["items"].getArray();
+
+	auto indexOf = [&items](const String& name)
+	{
+		for (int i = 0; i < items.size(); i++) if (items[i].getProperty("niceName", "").toString() == name) return i;
+		return -1;
+	};
+
+	//entries may be replayed on top of a snapshot that already has them, so they are applied by name
+	if (entry.hasProperty("rm"))
+	{
+		items.remove(indexOf(entry["rm"].toString()));
+	}
+	else if (entry.hasProperty("rn"))
+	{
+		const int index = indexOf(entry["rn"].toString());
+		if (index >= 0 && items[index].isObject()) items[index].getDynamicObject()->setProperty("niceName", entry["n"]);
+	}
+	else if (entry.hasProperty("add"))
+	{
+		var itemData = entry["add"];
+		const int index = indexOf(itemData.getProperty("niceName", "").toString());
+		if (index >= 0) items.set(index, itemData);
+		else items.insert(jlimit(0, items.size(), (int)entry["i"]), itemData);
+	}
+	else if (entry["order"].isArray())
+	{
+		Array<var> orderedItems;
+		for (auto& n : *entry["order"].getArray())
+		{
+			const int index = indexOf(n.toString());
+			if (index < 0) continue;
+			orderedItems.add(items[index]);
+			items.remove(index);
+		}
+
+		orderedItems.addArray(items);
+		items = orderedItems;
+	}
+
+	managerData.getDynamicObject()->setProperty("items", items);
+}
+
+String ShowJournal::getSessionLockName(const File& folder)
+{
+	return String(ProjectInfo::projectName) + "-autosave-" + folder.getFileName();
+}
+
+bool ShowJournal::isSessionRunning(const File& folder)
+{
+	//the lock of a crashed session is released by the system with its process
+	InterProcessLock lock(getSessionLockName(folder));
+	if (!lock.enter(0)) return true;
+	lock.exit();
+	return false;
+}
+
+File ShowJournal::getLastSessionFolder()
+{
+	File result;
+	for (auto& f : autosaveFolder.findChildFiles(File::findDirectories, false))
+	{
+		if (f == sessionFolder || !f.getChildFile("journal.log").existsAsFile() || isSessionRunning(f)) continue;
+		if (result == File() || f.getFileName().getLargeIntValue() > result.getFileName().getLargeIntValue()) result = f;
+	}
+
+	return result;
+}
+
+bool ShowJournal::hasRecovery()
+{
+	return getLastSessionFolder() != File();
+}
+
+void ShowJournal::pruneSessionFolders()
+{
+	//only the last crashed session can be recovered, older ones would pile up forever. Sessions of other running instances are kept
+	File lastSession = getLastSessionFolder();
+	for (auto& f : autosaveFolder.findChildFiles(File::findDirectories, false))
+	{
+		if (f == sessionFolder || f == lastSession || isSessionRunning(f)) continue;
+		f.deleteRecursively();
+	}
+}
+
+bool ShowJournal::recover()
+{
+	File folder = getLastSessionFolder();
+	if (!folder.isDirectory())
+	{
+		NLOGWARNING("Autosave", "No previous session to recover");
+		return false;
+	}
+
+	File baseline;
+	Array<var> entries;
+	var data;
+	if (readJournal(folder.getChildFile("journal.log"), baseline, entries)) data = readBaseline(baseline);
+
+	if (!data.isObject())
+	{
+		NLOGERROR("Autosave", "Could not read the show to recover from " << folder.getFullPathName());
+		return false;
+	}
+
+	//structure changes are applied to the baseline data, then all value changes are replayed in order
+	for (auto& e : entries)
+	{
+		if (e.hasProperty("m")) applyStructureEntry(data, e);
+	}
+
+	isReplaying = true;
+
+	//baselines and snapshots are read with the .blux layout, loaded like a document
+	engine->loadShowData(data, "Recovery");
+
+	int numReplayed = 0;
+	for (auto& e : entries)
+	{
+		if (!e.hasProperty("a")) continue;
+		if (Parameter* p = dynamic_cast<Parameter*>(engine->getControllableForAddress(e["a"].toString())))
+		{
+			p->setValue(e["v"]);
+			numReplayed++;
+		}
+	}
+
+	isReplaying = false;
+
+	folder.deleteRecursively();
+
+	//the recovered data without the replayed values, the values are journaled again as they are set above
+	reset(File(), data);
+	for (auto& e : entries)
+	{
+		if (!e.hasProperty("a")) continue;
+		addEntry(e, e["a"].toString());
+	}
+
+	NLOG("Autosave", "Recovered show from " << baseline.getFileName() << " with " << numReplayed << " changes replayed");
+	return true;
+}
+
+void ShowJournal::controllableFeedbackUpdate(ControllableContainer* cc, Controllable* c)
+{
+	if (!shouldRecord()) return;
+	if (c->type == Controllable::TRIGGER || !c->isSavable || c->isControllableFeedbackOnly) return;
+
+	Parameter* p = (Parameter*)c;
+	String address = p->getControlAddress(engine);
+
+	var entry(new DynamicObject());
+	entry.getDynamicObject()->setProperty("a", address);
+	entry.getDynamicObject()->setProperty("v", p->getValue());
+	addEntry(entry, address);
+}
+
+void ShowJournal::childStructureChanged(ControllableContainer* cc)
+{
+	if (!shouldRecord() || !managers.contains(cc)) return;
+
+	//items can be added or removed from other threads (scripts, OSC)
+	GenericScopedLock lock(pendingLock);
+	dirtyManagers.addIfNotAlreadyThere(cc->shortName);
+}
+
+void ShowJournal::itemStructureChanged(ControllableContainer* item)
+{
+	if (!shouldRecord() || item->parentContainer == nullptr) return;
+
+	GenericScopedLock lock(pendingLock);
+	dirtyItems.addIfNotAlreadyThere(item);
+	dirtyManagers.addIfNotAlreadyThere(item->parentContainer->shortName);
+}
+
+void ShowJournal::endLoadFile()
+{
+	reset(engine->getFile());
+}
+
+void ShowJournal::engineCleared()
+{
+	reset(File());
+}
+
+void ShowJournal::fileSaved(bool savedAs)
+{
+	reset(engine->getFile());
+}
+
+void ShowJournal::timerCallback()
+{
+	if (!isEnabled() || engine->isLoadingFile || engine->isClearing) return;
+
+	if (snapshotQueue.isEmpty() && snapshotRequested)
+	{
+		snapshotRequested = false;
+		snapshotQueue.add(BinaryShowFile::engineChunkName);
+		for (auto& m : managers) snapshotQueue.add(m->shortName);
+		snapshotChunks = var(new DynamicObject());
+
+		//changes recorded until now go to the current journal, the next ones to the journal that starts from this snapshot
+		GenericScopedLock lock(pendingLock);
+		preRotationEntries.addArray(pendingEntries);
+		pendingEntries.clearQuick();
+		pendingValueIndices.clear();
+		rotateRequested = true;
+	}
+
+	//one manager per tick, so a snapshot never blocks the message thread for the whole show.
+	//This is only needed for shows that were never written to disk, compactions are done by the journal thread
+	if (!snapshotQueue.isEmpty())
+	{
+		String name = snapshotQueue[0];
+		snapshotQueue.remove(0);
+
+		//built with the .blux layout, BinaryShowFile::write splits it back into chunks
+		if (name == BinaryShowFile::engineChunkName)
+		{
+			var engineData = engine->Engine::getJSONData();
+			for (auto& p : engineData.getDynamicObject()->getProperties()) snapshotChunks.getDynamicObject()->setProperty(p.name, p.value);
+		}
+		else
+		{
+			for (int i = 0; i < managers.size(); i++)
+			{
+				ControllableContainer* m = managers[i];
+				if (m->shortName != name) continue;
+
+				//changes made since the rotation are journaled first, replaying them on top of this snapshot doesn't change it
+				bool isDirty = false;
+				{
+					GenericScopedLock lock(pendingLock);
+					const int index = dirtyManagers.indexOf(name);
+					isDirty = index >= 0;
+					dirtyManagers.remove(index);
+				}
+				if (isDirty) addStructureEntries(i);
+
+				snapshotChunks.getDynamicObject()->setProperty(name, m->getJSONData());
+			}
+		}
+
+		if (snapshotQueue.isEmpty())
+		{
+			GenericScopedLock lock(pendingLock);
+			snapshotData = snapshotChunks;
+			snapshotReady = true;
+			snapshotChunks = var();
+		}
+		return;
+	}
+
+	if (Time::getMillisecondCounter() - lastStructureCheckTime < (uint32)structureCheckInterval) return;
+
+	StringArray managersToCheck;
+	{
+		GenericScopedLock lock(pendingLock);
+		managersToCheck.swapWith(dirtyManagers);
+	}
+
+	if (managersToCheck.isEmpty()) return;
+
+	for (int i = 0; i < managers.size(); i++)
+	{
+		if (managersToCheck.contains(managers[i]->shortName)) addStructureEntries(i);
+	}
+
+	lastStructureCheckTime = Time::getMillisecondCounter();
+}
+
+void ShowJournal::run()
+{
+	while (!threadShouldExit())
+	{
+		wait(flushInterval);
+		flush();
+	}
+
+	flush();
+}
+
+void ShowJournal::flush()
+{
+	Array<var> entriesBefore;
+	Array<var> entries;
+	bool doReset = false;
+	bool doRotate = false;
+	String baseline;
+	var baselineData;
+	var snapshot;
+
+	{
+		GenericScopedLock lock(pendingLock);
+		doReset = resetRequested;
+		baseline = resetBaseline;
+		baselineData = resetBaselineData;
+		resetBaselineData = var();
+		resetRequested = false;
+		doRotate = rotateRequested;
+		rotateRequested = false;
+		entriesBefore.swapWith(preRotationEntries);
+		entries.swapWith(pendingEntries);
+		pendingValueIndices.clear();
+
+		if (snapshotReady)
+		{
+			snapshot = snapshotData;
+			snapshotData = var();
+			snapshotReady = false;
+		}
+	}
+
+	if (doReset)
+	{
+		journalStream.reset();
+		waitingForSnapshot = false;
+		for (auto& f : sessionFolder.findChildFiles(File::findFiles, false, "journal*.log")) f.deleteFile();
+
+		if (baselineData.isObject())
+		{
+			snapshotFile = getNextSnapshotFile();
+			if (!BinaryShowFile::write(baselineData, snapshotFile)) LOGERROR("Could not write autosave snapshot " << snapshotFile.getFullPathName());
+			baseline = snapshotFile.getFullPathName();
+		}
+
+		openJournal(baseline, File());
+		deleteOldSnapshots();
+	}
+
+	writeEntries(entriesBefore);
+
+	if (doRotate)
+	{
+		journalStream.reset();
+		previousJournalFile = sessionFolder.getChildFile("journal-" + String(++rotationIndex) + ".log");
+		journalFile.moveFileTo(previousJournalFile);
+		snapshotFile = getNextSnapshotFile();
+		openJournal(snapshotFile.getFullPathName(), previousJournalFile);
+		waitingForSnapshot = true;
+	}
+
+	writeEntries(entries);
+
+	if (snapshot.isObject()) writeSnapshot(snapshot);
+
+	if (!isEnabled() || snapshotRequested || waitingForSnapshot || journalBytes == 0) return;
+
+	const uint32 snapshotInterval = (uint32)BluxSettings::getInstance()->autosaveSnapshotInterval->intValue() * 60000;
+	if (journalBytes > maxJournalBytes || Time::getMillisecondCounter() - lastSnapshotTime > snapshotInterval)
+	{
+		lastSnapshotTime = Time::getMillisecondCounter();
+		compact();
+	}
+}
+
+void ShowJournal::openJournal(const String& baseline, const File& previous, const Array<var>& initialEntries)
+{
+	journalStream.reset();
+	journalBytes = 0;
+
+	var header(new DynamicObject());
+	header.getDynamicObject()->setProperty("baseline", baseline);
+	if (previous != File()) header.getDynamicObject()->setProperty("previous", previous.getFileName());
+
+	//written aside and moved in place, so a crash never leaves a journal without its header
+	TemporaryFile tf(journalFile);
+	{
+		FileOutputStream os(tf.getFile());
+		if (!os.failedToOpen())
+		{
+			os << JSON::toString(header, true) << "\n";
+			for (auto& e : initialEntries) os << JSON::toString(e, true) << "\n";
+			os.flush();
+		}
+	}
+
+	if (tf.overwriteTargetFileWithTemporary()) journalStream.reset(new FileOutputStream(journalFile)); //appends after the header
+
+	if (journalStream == nullptr || journalStream->failedToOpen())
+	{
+		LOGERROR("Could not open autosave journal " << journalFile.getFullPathName());
+		journalStream.reset();
+	}
+}
+
+void ShowJournal::writeEntries(const Array<var>& entries)
+{
+	if (journalStream == nullptr || entries.isEmpty()) return;
+
+	for (auto& e : entries)
+	{
+		String line = JSON::toString(e, true) + "\n";
+		*journalStream << line;
+		journalBytes += (int64)line.getNumBytesAsUTF8();
+	}
+
+	journalStream->flush();
+}
+
+void ShowJournal::writeSnapshot(const var& data)
+{
+	if (!BinaryShowFile::write(data, snapshotFile))
+	{
+		LOGERROR("Could not write autosave snapshot " << snapshotFile.getFullPathName());
+		return;
+	}
+
+	//the journals before this snapshot are not needed for recovery anymore
+	waitingForSnapshot = false;
+	for (auto& f : sessionFolder.findChildFiles(File::findFiles, false, "journal-*.log")) f.deleteFile();
+	deleteOldSnapshots();
+}
+
+void ShowJournal::compact()
+{
+	//the new snapshot is built from the baseline and the journal, the live show is not touched
+	journalStream.reset();
+
+	File baseline;
+	Array<var> entries;
+	var data;
+	if (readJournal(journalFile, baseline, entries)) data = readBaseline(baseline);
+
+	if (!data.isObject())
+	{
+		//the baseline is gone (or was never written), only the live show can give a new one
+		journalStream.reset(new FileOutputStream(journalFile));
+		requestSnapshot();
+		return;
+	}
+
+	//value changes are not applied to the data (they need the live show to resolve their address),
+	//only the last value of each parameter is kept in the new journal
+	Array<var> values;
+	HashMap<String, bool> seenAddresses;
+	for (int i = entries.size() - 1; i >= 0; i--)
+	{
+		const var& e = entries.getReference(i);
+		if (e.hasProperty("m")) continue;
+
+		const String address = e["a"].toString();
+		if (seenAddresses.contains(address)) continue;
+		seenAddresses.set(address, true);
+		values.add(e);
+	}
+
+	for (auto& e : entries)
+	{
+		if (e.hasProperty("m")) applyStructureEntry(data, e);
+	}
+
+	File newSnapshot = getNextSnapshotFile();
+	if (!BinaryShowFile::write(data, newSnapshot))
+	{
+		LOGERROR("Could not write autosave snapshot " << newSnapshot.getFullPathName());
+		journalStream.reset(new FileOutputStream(journalFile));
+		return;
+	}
+
+	Array<var> orderedValues;
+	for (int i = values.size() - 1; i >= 0; i--) orderedValues.add(values[i]);
+
+	snapshotFile = newSnapshot;
+	openJournal(snapshotFile.getFullPathName(), File(), orderedValues);
+	deleteOldSnapshots();
+}
+
+File ShowJournal::getNextSnapshotFile()
+{
+	//each snapshot gets a new file, the previous one is kept until a journal that doesn't need it is in place
+	return sessionFolder.getChildFile("snapshot-" + String(++rotationIndex) + ".bluxb");
+}
+
+void ShowJournal::deleteOldSnapshots()
+{
+	File baseline;
+	Array<var> entries;
+	readJournal(journalFile, baseline, entries);
+
+	for (auto& f : sessionFolder.findChildFiles(File::findFiles, false, "snapshot-*.bluxb"))
+	{
+		if (f != baseline && f != snapshotFile) f.deleteFile();
+	}
+}
+
+bool ShowJournal::readJournal(const File& f, File& baseline, Array<var>& entries)
+{
+	StringArray lines;
+	f.readLines(lines);
+	if (lines.isEmpty()) return false;
+
+	var header = JSON::parse(lines[0]);
+	File previousFile = f.getSiblingFile(header.getProperty("previous", "").toString());
+
+	//a previous journal is only kept while the snapshot this journal starts from is being written
+	if (previousFile != f.getParentDirectory() && previousFile.existsAsFile())
+	{
+		if (!readJournal(previousFile, baseline, entries)) return false;
+	}
+	else
+	{
+		String baselinePath = header.getProperty("baseline", "").toString();
+		baseline = baselinePath.isNotEmpty() ? File(baselinePath) : File();
+	}
+
+	//the last line may have been cut by a crash, it's simply skipped
+	for (int i = 1; i < lines.size(); i++)
+	{
+		if (lines[i].isEmpty()) continue;
+		var e = JSON::parse(lines[i]);
+		if (e.isObject()) entries.add(e);
+	}
+
+	return baseline.existsAsFile();
+}
+
+var ShowJournal::readBaseline(const File& baseline)
+{
+	return BinaryShowFile::isBinaryShowFile(baseline) ? BinaryShowFile::read(baseline) : JSON::parse(baseline);
+}
@@ -0,0 +1,134 @@
+/*
+  ==============================================================================
+
+    ShowJournal.h
+    Created: 18 Oct 2026 5:03:48pm
+    Author:  bkupe
+
+  ==============================================================================
+*/
+
+#pragma once
+
+class BluxEngine;
+
+//Background autosave : parameter changes are recorded as they happen and appended to a journal file by a thread,
+//and structure changes of the show managers are recorded per item (added, removed, renamed, reordered or changed inside).
+//The journal starts from a baseline (the saved show file, or a binary snapshot) and is compacted by the journal thread
+//into a new snapshot when it grows, from the baseline and the journal rather than from the live show.
+//The live show is only serialized, one manager per timer tick, when there is no baseline at all (new or cleared show).
+//Each session has its own folder, deleted on a clean exit,
+//so a folder left by a previous session can be recovered by loading its baseline and replaying its journal.
+//A session holds an inter-process lock while it runs, so folders of other running instances are never pruned or recovered.
+class ShowJournal :
+    public Thread,
+    public Timer,
+    public ControllableContainerListener,
+    public EngineListener
+{
+public:
+    ShowJournal(BluxEngine* engine);
+    ~ShowJournal();
+
+    BluxEngine* engine;
+    Array<ControllableContainer*> managers;
+
+    File autosaveFolder;
+    File sessionFolder;
+    File journalFile;
+    File snapshotFile;
+    std::unique_ptr<InterProcessLock> sessionLock;
+
+    static const int flushInterval = 250; //ms
+    static const int structureCheckInterval = 1000; //ms
+    static const int64 maxJournalBytes = 4 * 1024 * 1024;
+
+    //recorded from any thread, written by the journal thread
+    CriticalSection pendingLock;
+    StringArray dirtyManagers; //compared to their known items by the timer on the message thread
+    Array<WeakReference<ControllableContainer>> dirtyItems; //items whose own structure changed, serialized again
+    Array<var> pendingEntries;
+    HashMap<String, int> pendingValueIndices; //consecutive changes of the same parameter replace each other
+    Array<var> preRotationEntries;
+    bool resetRequested;
+    String resetBaseline;
+    var resetBaselineData;
+    bool rotateRequested;
+    bool snapshotReady;
+    var snapshotData;
+
+    //journal thread only
+    std::unique_ptr<FileOutputStream> journalStream;
+    File previousJournalFile;
+    int64 journalBytes;
+    uint32 lastSnapshotTime;
+    int rotationIndex;
+    bool waitingForSnapshot;
+    std::atomic<bool> snapshotRequested;
+
+    //message thread only
+    struct ManagerItems
+    {
+        Array<WeakReference<ControllableContainer>> items;
+        StringArray names;
+    };
+
+    OwnedArray<ManagerItems> managerItems; //items of each manager as last journaled, same order as managers
+
+    //the managers are only told that something changed below them, the items tell which one
+    class ItemListener : public ControllableContainerListener
+    {
+    public:
+        ItemListener(ShowJournal* journal) : journal(journal) {}
+        ShowJournal* journal;
+        void childStructureChanged(ControllableContainer* cc) override { journal->itemStructureChanged(cc); }
+    };
+
+    ItemListener itemListener;
+    uint32 lastStructureCheckTime;
+    StringArray snapshotQueue;
+    var snapshotChunks;
+    bool isReplaying;
+
+    bool isEnabled() const;
+    bool shouldRecord() const;
+
+    //baselineData is used when the show was not loaded from a file, so the journal doesn't have to serialize it back
+    void reset(const File& baseline, const var& baselineData = var());
+    void requestSnapshot();
+    void addEntry(const var& entry, const String& valueAddress = String());
+
+    static Array<ControllableContainer*> getItems(ControllableContainer* manager);
+    void resetManagerItems();
+    void addStructureEntries(int managerIndex);
+    static void applyStructureEntry(var data, const var& entry);
+
+    static String getSessionLockName(const File& folder);
+    static bool isSessionRunning(const File& folder);
+    File getLastSessionFolder();
+    bool hasRecovery();
+    bool recover();
+    void pruneSessionFolders();
+
+    void controllableFeedbackUpdate(ControllableContainer* cc, Controllable* c) override;
+    void childStructureChanged(ControllableContainer* cc) override;
+    void itemStructureChanged(ControllableContainer* item);
+
+    void endLoadFile() override;
+    void engineCleared() override;
+    void fileSaved(bool savedAs) override;
+
+    void timerCallback() override;
+
+    void run() override;
+    void flush();
+    void openJournal(const String& baseline, const File& previous, const Array<var>& initialEntries = Array<var>());
+    void writeEntries(const Array<var>& entries);
+    void writeSnapshot(const var& data);
+    void compact();
+    File getNextSnapshotFile();
+    void deleteOldSnapshots();
+
+    static bool readJournal(const File& f, File& baseline, Array<var>& entries);
+    static var readBaseline(const File& baseline);
+};
@@ -0,0 +1,144 @@
+/*
+  ==============================================================================
+
+    SyncLoopbackTester.cpp
+    Created: 18 Oct 2026 9:12:37pm
+    Author:  bkupe
+
+  ==============================================================================
+*/
+
+SyncLoopbackTester::SyncLoopbackTester() :
+	numFrames(100),
+	numUniverses(8),
+	syncAddress(1000)
+{
+}
+
+bool SyncLoopbackTester::run()
+{
+	report.clear();
+
+	DatagramSocket receiver;
+	if (!receiver.bindToPort(0, "127.0.0.1"))
+	{
+		addReport("[FAIL] could not open the loopback socket");
+		return false;
+	}
+
+	addReport("Sync loopback test : " + String(numFrames) + " frames of " + String(numUniverses) + " universes, sync address " + String(syncAddress));
+
+	std::unique_ptr<DMXInterface> itf(new DMXInterface());
+	itf->sendOnChangeOnly->setValue(false);
+	itf->syncUniverse->setValue(syncAddress);
+	itf->sendSync->setValue(true);
+	itf->dmxType->setValueWithData(DMXDevice::SACN);
+
+	//data and sync packets follow the device output, set it to unicast on the loopback socket
+	if (itf->sacnHostParam == nullptr || itf->sacnPortParam == nullptr)
+	{
+		addReport("[FAIL] the sACN device has no remote host or port to send to");
+		return false;
+	}
+
+	if (itf->sacnMulticastParam != nullptr) itf->sacnMulticastParam->setValue(false);
+	itf->sacnHostParam->setValue("127.0.0.1");
+	itf->sacnPortParam->setValue(receiver.getBoundPort());
+
+	uint8 buffer[1024];
+	Array<int> received; //universes received since the last sync
+	HashMap<int, int> receivedTags;
+	int numBadAddresses = 0;
+	int numIncompleteSyncs = 0;
+	int numMissedFrames = 0;
+
+	for (int frame = 1; frame <= numFrames; frame++)
+	{
+		for (int i = 1; i <= numUniverses; i++)
+		{
+			DMXUniverse* u = itf->getUniverse(0, 0, i);
+			u->updateValue(0, frame & 0xFF);
+			u->updateValue(1, (frame >> 8) & 0xFF);
+		}
+
+		itf->finishSendValues();
+
+		//the sender may still repeat the previous frame, read until the sync of this one
+		bool frameSynced = false;
+		const uint32 timeout = Time::getMillisecondCounter() + 1000;
+		while (!frameSynced && Time::getMillisecondCounter() < timeout)
+		{
+			if (receiver.waitUntilReady(true, 100) != 1) continue;
+
+			const int size = receiver.read(buffer, sizeof(buffer), false);
+			if (size < 22) continue;
+
+			const uint32 vector = ByteOrder::bigEndianInt(buffer + 18);
+			if (vector == 0x04 && size >= DMXInterface::sacnDataHeaderSize + 2)
+			{
+				if (ByteOrder::bigEndianShort(buffer + 109) != syncAddress) numBadAddresses++;
+
+				const int universe = ByteOrder::bigEndianShort(buffer + 113);
+				received.add(universe);
+				receivedTags.set(universe, buffer[126] | (buffer[127] << 8));
+			}
+			else if (vector == 0x08 && size >= DMXInterface::sacnSyncPacketSize)
+			{
+				if (ByteOrder::bigEndianShort(buffer + 45) != syncAddress) numBadAddresses++;
+
+				//each universe exactly once since the previous sync, all from the same frame
+				const int tag = received.isEmpty() ? -1 : receivedTags[received[0]];
+				bool complete = received.size() == numUniverses;
+				for (int i = 1; i <= numUniverses && complete; i++) complete = received.contains(i) && receivedTags[i] == tag;
+
+				if (!complete)
+				{
+					numIncompleteSyncs++;
+					addReport("[FAIL] sync received after " + String(received.size()) + " universes, while sending frame " + String(frame));
+				}
+				else if (tag == frame)
+				{
+					frameSynced = true;
+				}
+
+				received.clearQuick();
+			}
+		}
+
+		if (!frameSynced) numMissedFrames++;
+	}
+
+	itf->enabled->setValue(false);
+	itf->clearItem();
+
+	if (numBadAddresses > 0) addReport("[FAIL] " + String(numBadAddresses) + " packets without the sync address");
+	if (numMissedFrames > 0) addReport("[FAIL] " + String(numMissedFrames) + " frames never received before their sync");
+
+	const bool result = numBadAddresses == 0 && numIncompleteSyncs == 0 && numMissedFrames == 0;
+	if (result) addReport("[OK] every universe of each frame arrived before its sync");
+	return result;
+}
+
+void SyncLoopbackTester::addReport(const String& line)
+{
+	report.add(line);
+	NLOG("Sync Test", line);
+	std::cout << line << std::endl;
+}
+
+bool SyncLoopbackTester::isSyncTestCommandLine(const String& commandLine)
+{
+	return StringArray::fromTokens(commandLine, true).contains("--sync-test");
+}
+
+int SyncLoopbackTester::runFromCommandLine(const String& commandLine)
+{
+	StringArray args = StringArray::fromTokens(commandLine, true);
+	for (auto& a : args) a = a.unquoted();
+
+	SyncLoopbackTester tester;
+	if (args.contains("--frames")) tester.numFrames = jmax(args[args.indexOf("--frames") + 1].getIntValue(), 1);
+	if (args.contains("--universes")) tester.numUniverses = jlimit(1, 512, args[args.indexOf("--universes") + 1].getIntValue());
+
+	return tester.run() ? 0 : 1;
+}
@@ -0,0 +1,36 @@
+/*
+  ==============================================================================
+
+    SyncLoopbackTester.h
+    Created: 18 Oct 2026 9:12:37pm
+    Author:  bkupe
+
+  ==============================================================================
+*/
+
+#pragma once
+
+//Loopback check of the sACN synchronization : a DMX interface with sync enabled sends its universes to a local socket,
+//and every universe of frame N must arrive, tagged with the sync address, before sync N.
+//Frames are tagged in the first two channels of each universe.
+//Run with : Blux --sync-test [--frames N] [--universes U]
+class SyncLoopbackTester
+{
+public:
+    SyncLoopbackTester();
+    ~SyncLoopbackTester() {}
+
+    int numFrames;
+    int numUniverses;
+    int syncAddress;
+
+    StringArray report;
+
+    //returns true if every frame was received complete and tagged before its sync
+    bool run();
+
+    void addReport(const String& line);
+
+    static bool isSyncTestCommandLine(const String& commandLine);
+    static int runFromCommandLine(const String& commandLine);
+};
@@ -0,0 +1,232 @@
+/*
+  ==============================================================================
+
+    VizStreamer.cpp
+    Created: 18 Oct 2026 11:02:15am
+    Author:  bkupe
+
+  ==============================================================================
+*/
+
+VizStreamer::VizStreamer(BluxEngine* engine) :
+	Thread("Viz Streamer"),
+	engine(engine),
+	numValues(0),
+	tableVersion(0),
+	frameIndex(0),
+	forceKeyFrame(true)
+{
+	startThread();
+}
+
+VizStreamer::~VizStreamer()
+{
+	cancelPendingUpdate();
+	stopThread(1000);
+}
+
+bool VizStreamer::isStreaming() const
+{
+	return BluxSettings::getInstance()->vizBinaryStream->boolValue();
+}
+
+var VizStreamer::getTableData()
+{
+	GenericScopedLock lock(tableLock);
+
+	var data(new DynamicObject());
+	data.getDynamicObject()->setProperty("version", (int)frameVersion);
+	data.getDynamicObject()->setProperty("tableVersion", (int)tableVersion);
+	data.getDynamicObject()->setProperty("numValues", numValues);
+
+	var entriesData;
+	for (auto& e : entries)
+	{
+		var eData(new DynamicObject());
+		eData.getDynamicObject()->setProperty("object", e.object);
+		eData.getDynamicObject()->setProperty("controlAddress", e.address);
+		eData.getDynamicObject()->setProperty("offset", e.offset);
+		eData.getDynamicObject()->setProperty("size", e.size);
+		entriesData.append(eData);
+	}
+	data.getDynamicObject()->setProperty("entries", entriesData);
+
+	return data;
+}
+
+void VizStreamer::requestKeyFrame()
+{
+	forceKeyFrame = true;
+}
+
+int VizStreamer::readSnapshotSize(const Array<float>& buffer, int& bufferIndex)
+{
+	//snapshot layout is [size, values...] for each computed parameter
+	if (bufferIndex >= buffer.size()) return 0;
+	int size = (int)buffer.getUnchecked(bufferIndex);
+	bufferIndex += 1 + size;
+	return size;
+}
+
+bool VizStreamer::checkTable()
+{
+	//called with the object lock held, only compares pointers and sizes so it's cheap to do every frame
+	int index = 0;
+	for (auto& o : ObjectManager::getInstance()->items)
+	{
+		for (auto& c : o->componentManager->items)
+		{
+			const Array<float>& buffer = c->vizSnapshot.getReadBuffer();
+			int bufferIndex = 0;
+			for (auto& p : c->computedParameters)
+			{
+				if (index >= entries.size()) return false;
+				const Entry& e = entries.getReference(index);
+				if (e.parameter != p || e.size != readSnapshotSize(buffer, bufferIndex)) return false;
+				index++;
+			}
+		}
+	}
+
+	return index == entries.size();
+}
+
+void VizStreamer::rebuildTable()
+{
+	GenericScopedLock lock(tableLock);
+
+	entries.clearQuick();
+	int offset = 0;
+	for (auto& o : ObjectManager::getInstance()->items)
+	{
+		for (auto& c : o->componentManager->items)
+		{
+			const Array<float>& buffer = c->vizSnapshot.getReadBuffer();
+			int bufferIndex = 0;
+			for (auto& p : c->computedParameters)
+			{
+				Entry e;
+				e.parameter = p;
+				e.object = o->shortName;
+				e.address = p->getControlAddress(engine);
+				e.offset = offset;
+				e.size = readSnapshotSize(buffer, bufferIndex);
+				entries.add(e);
+				offset += e.size;
+			}
+		}
+	}
+
+	numValues = offset;
+	values.clearQuick();
+	values.insertMultiple(0, 0, numValues);
+	tableVersion++;
+	forceKeyFrame = true;
+}
+
+void VizStreamer::snapshot()
+{
+	ObjectManager* om = ObjectManager::getInstanceWithoutCreating();
+	if (om == nullptr) return;
+
+	GenericScopedLock lock(om->items.getLock());
+
+	//a component that wasn't computed since the last frame keeps its previous read buffer
+	for (auto& o : om->items)
+	{
+		for (auto& c : o->componentManager->items) c->vizSnapshot.pull();
+	}
+
+	if (!checkTable())
+	{
+		rebuildTable();
+		triggerAsyncUpdate(); //clients need the new table before they can read the next frames
+	}
+
+	float* v = values.getRawDataPointer();
+	int index = 0;
+	for (auto& o : om->items)
+	{
+		for (auto& c : o->componentManager->items)
+		{
+			const float* buffer = c->vizSnapshot.getReadBuffer().begin();
+			int bufferIndex = 0;
+			for (int i = 0; i < c->computedParameters.size(); i++)
+			{
+				const Entry& e = entries.getReference(index++);
+				if (e.size > 0) FloatVectorOperations::copy(v + e.offset, buffer + bufferIndex + 1, e.size);
+				bufferIndex += 1 + e.size;
+			}
+		}
+	}
+}
+
+void VizStreamer::sendFrame()
+{
+	const float* v = values.getRawDataPointer();
+
+	//requests coming from the message thread while this frame is built are kept for the next one
+	const bool keyFrame = forceKeyFrame.exchange(false);
+
+	int numChanged = 0;
+	bool useDelta = !keyFrame && BluxSettings::getInstance()->vizDeltaEncoding->boolValue() && prevValues.size() == numValues;
+	if (useDelta)
+	{
+		const float* pv = prevValues.getRawDataPointer();
+		for (int i = 0; i < numValues; i++) if (v[i] != pv[i]) numChanged++;
+
+		if (numChanged == 0) return;
+		useDelta = numChanged * 8 < numValues * 4; //only when smaller than a full frame
+	}
+
+	frameStream.reset();
+	frameStream.writeByte((char)frameVersion);
+	frameStream.writeByte((char)(useDelta ? DELTA_FRAME : FULL_FRAME));
+	frameStream.writeShort(0);
+	frameStream.writeInt((int)tableVersion);
+	frameStream.writeInt((int)frameIndex++);
+
+	if (useDelta)
+	{
+		const float* pv = prevValues.getRawDataPointer();
+		frameStream.writeInt(numChanged);
+		for (int i = 0; i < numValues; i++)
+		{
+			if (v[i] == pv[i]) continue;
+			frameStream.writeInt(i);
+			frameStream.writeFloat(v[i]);
+		}
+	}
+	else
+	{
+		frameStream.writeInt(numValues);
+		frameStream.write(v, numValues * sizeof(float));
+	}
+
+	prevValues = values;
+
+	MemoryBlock b(frameStream.getData(), frameStream.getDataSize());
+	engine->vizServer->send(b);
+}
+
+void VizStreamer::run()
+{
+	while (!threadShouldExit())
+	{
+		uint32 millisBefore = Time::getMillisecondCounter();
+
+		if (isStreaming() && !engine->isClearing && !engine->isLoadingFile && engine->vizServer != nullptr && engine->vizServer->isConnected)
+		{
+			snapshot();
+			sendFrame();
+		}
+
+		int msToWait = 1000 / jmax(BluxSettings::getInstance()->vizStreamFPS->intValue(), 1) - (int)(Time::getMillisecondCounter() - millisBefore);
+		wait(jmax(msToWait, 1));
+	}
+}
+
+void VizStreamer::handleAsyncUpdate()
+{
+	engine->sendAllData();
+}
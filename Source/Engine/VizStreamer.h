@@ -0,0 +1,65 @@
+/*
+  ==============================================================================
+
+    VizStreamer.h
+    Created: 18 Oct 2026 11:02:15am
+    Author:  bkupe
+
+  ==============================================================================
+*/
+
+#pragma once
+
+class BluxEngine;
+
+//Snapshots all computed object values at a fixed rate and sends them to the viz clients as one binary frame,
+//instead of one JSON message per changed parameter. Values are read from the vizSnapshot buffer of each component, never from the parameters.
+//Frame layout (little endian) : uint8 version, uint8 frameType, uint16 reserved, uint32 tableVersion, uint32 frameIndex, uint32 count
+//then for a full frame, count floats in table order, and for a delta frame, count pairs of (uint32 valueIndex, float value).
+class VizStreamer :
+    public Thread,
+    public AsyncUpdater
+{
+public:
+    VizStreamer(BluxEngine* engine);
+    ~VizStreamer();
+
+    enum FrameType { FULL_FRAME, DELTA_FRAME };
+    static const uint8 frameVersion = 1;
+
+    BluxEngine* engine;
+
+    struct Entry
+    {
+        Parameter* parameter = nullptr;
+        String object;
+        String address;
+        int offset = 0;
+        int size = 1; //as published in the snapshot, 0 until the component has been computed once
+    };
+
+    CriticalSection tableLock;
+    Array<Entry> entries;
+    int numValues;
+    uint32 tableVersion;
+    uint32 frameIndex;
+    std::atomic<bool> forceKeyFrame;
+
+    Array<float> values;
+    Array<float> prevValues;
+    MemoryOutputStream frameStream;
+
+    bool isStreaming() const;
+    var getTableData();
+    void requestKeyFrame();
+
+    bool checkTable();
+    void rebuildTable();
+    void snapshot();
+    void sendFrame();
+
+    static int readSnapshotSize(const Array<float>& buffer, int& bufferIndex);
+
+    void run() override;
+    void handleAsyncUpdate() override;
+};
@@ -15,6 +15,10 @@
 DMXInterface::DMXInterface() :
 	Interface(getTypeString()),
 	Thread("DMX Interface"),
+	syncSender(true),
+	syncSequence(0),
+	hasNewFrame(false),
+	frameReadyTime(0),
 	dmxInterfaceNotifier(20)
 {
 	dmxType = addEnumParameter("DMX Type", "Choose the type of dmx interface you want to connect");
@@ -31,7 +35,25 @@ DMXInterface::DMXInterface() :
 	defaultUniverse = addIntParameter("Universe", "The universe", 0, 0, 15, false);
 
 	sendRate = addIntParameter("Send Rate", "The rate at which to send data.", 40, 1, 200);
-	sendOnChangeOnly = addBoolParameter("Send On Change Only", "Only send a universe if one of its channels has changed", false);
+	sendOnChangeOnly = addBoolParameter("Send On Change Only", "Only send a universe if one of its channels has changed. With sACN sync, the packets stop after the last changed channel", false);
+	sendSlices = addIntParameter("Send Slices", "The number of groups the universes are split into, each group being sent at a regular interval during the frame. Higher values avoid sending bursts of packets when there are many universes", 4, 1, 64);
+
+	keepAliveTime = addIntParameter("Keep Alive Time", "When sending on change only, unchanged universes are still sent at this interval (in ms) so receivers don't time out. 0 to never resend them", 1000, 0, 10000);
+
+	sendSync = addBoolParameter("Send Sync", "If checked, an ArtSync or sACN synchronization packet is sent after all the universes of a frame, for receivers that hold their output until they get it", false);
+	syncUniverse = addIntParameter("Sync Universe", "sACN only, the universe used for synchronization packets. Receivers must be set to the same sync address", 1, 1, 63999);
+	syncHost = addStringParameter("Sync Host", "Where to send the sync packets, as host or host:port. If empty, ArtSync is broadcast and sACN sync packets follow the device output : its remote host in unicast, the multicast address of the sync universe otherwise", "");
+
+	Uuid cid;
+	memcpy(syncCID, cid.getRawData(), 16);
+
+	sendLatency = addFloatParameter("Send Latency", "Time in ms between a frame being computed and its last universe being sent", 0, 0);
+	sendLatency->setControllableFeedbackOnly(true);
+	sendLatency->isSavable = false;
+
+	droppedFrames = addIntParameter("Dropped Frames", "Number of frames with changes that were replaced by a newer one before being sent", 0, 0);
+	droppedFrames->setControllableFeedbackOnly(true);
+	droppedFrames->isSavable = false;
 
 
 	channelTestingMode = addBoolParameter("Channel Testing Mode", "Is testing with the Channel view ?", false);
@@ -91,8 +113,15 @@ void DMXInterface::setCurrentDMXDevice(DMXDevice* d)
 	}
 
 	dmxDevice.reset(d);
+	resolveSACNOutputParams();
+	resetStats();
 
 	dmxConnected->hideInEditor = dmxDevice == nullptr || dmxDevice->type == DMXDevice::ARTNET;
+
+	bool isNetworkDevice = dmxDevice != nullptr && (dmxDevice->type == DMXDevice::ARTNET || dmxDevice->type == DMXDevice::SACN);
+	sendSync->hideInEditor = !isNetworkDevice;
+	syncHost->hideInEditor = !isNetworkDevice;
+	syncUniverse->hideInEditor = dmxDevice == nullptr || dmxDevice->type != DMXDevice::SACN;
 	dmxConnected->setValue(false);
 
 	if (dmxDevice != nullptr)
@@ -212,13 +241,50 @@ void DMXInterface::sendValuesForObjectInternal(Object* o)
 
 void DMXInterface::finishSendValues()
 {
-	GenericScopedLock lock(universesToSend.getLock());
-	universesToSend.clear();
-	for (auto& u : universes)
+	bool dropped = false;
+
 	{
-		universesToSend.add(new DMXUniverse(u));
-		u->isDirty = false;
+		GenericScopedLock lock(universesToSend.getLock());
+
+		HashMap<int, Range<int>> unsentRanges;
+		if (hasNewFrame)
+		{
+			//the sender thread didn't pick up the previous frame in time, keep its changes for send on change only.
+			//With a compute rate above the send rate this is the normal case, it is only a drop if the overwritten frame had changes that were never sent
+			GenericScopedLock slock(statsLock);
+			for (auto& f : universesToSend)
+			{
+				if (f->dirtyRange.isEmpty()) continue;
+
+				const int index = DMXUniverse::getUniverseIndex(f->universe->net, f->universe->subnet, f->universe->universe);
+				universeStats.getReference(index).droppedFrames++;
+				unsentRanges.set(index, f->dirtyRange);
+				dropped = true;
+			}
+		}
+
+		universesToSend.clear();
+		for (auto& u : universes)
+		{
+			const int index = DMXUniverse::getUniverseIndex(u->net, u->subnet, u->universe);
+			DMXFrame::Ptr f = new DMXFrame(u, lastFrames[index].get());
+
+			if (unsentRanges.contains(index))
+			{
+				Range<int> unsent = unsentRanges[index];
+				f->dirtyRange = f->dirtyRange.isEmpty() ? unsent : f->dirtyRange.getUnionWith(unsent);
+			}
+
+			universesToSend.add(f);
+			lastFrames.set(index, f);
+			u->isDirty = false;
+		}
+
+		hasNewFrame = true;
+		frameReadyTime = Time::getMillisecondCounterHiRes();
 	}
+
+	if (dropped) droppedFrames->setValue(droppedFrames->intValue() + 1);
 }
 
 
@@ -235,44 +301,74 @@ DMXUniverse* DMXInterface::getUniverse(int net, int subnet, int universe, bool c
 	return u;
 }
 
+DMXInterface::UniverseStats DMXInterface::getUniverseStats(int net, int subnet, int universe)
+{
+	GenericScopedLock lock(statsLock);
+	return universeStats[DMXUniverse::getUniverseIndex(net, subnet, universe)];
+}
+
+void DMXInterface::resetStats()
+{
+	{
+		GenericScopedLock lock(statsLock);
+		universeStats.clear();
+	}
+
+	sendLatency->setValue(0);
+	droppedFrames->setValue(0);
+}
+
 void DMXInterface::run()
 {
+	double frameTime = 0;
 
 	while (!threadShouldExit())
 	{
 		double loopStartTime = Time::getMillisecondCounterHiRes();
+		double rateMS = 1000.0 / sendRate->intValue();
 
+		bool isNewFrame = false;
 		{
-			//if (dmxDevice == nullptr) return;
-
-			bool sendOnChange = sendOnChangeOnly->boolValue();
-
 			GenericScopedLock lock(universesToSend.getLock());
-			for (auto& u : universesToSend)
+			if (hasNewFrame)
 			{
-				if (sendOnChange && !u->isDirty) continue;
-				{
-					GenericScopedLock lock(deviceLock);
-					if (dmxDevice != nullptr) dmxDevice->sendDMXValues(u);
-				}
-
+				sendingUniverses.swapWith(universesToSend);
+				universesToSend.clear();
+				hasNewFrame = false;
+				frameTime = frameReadyTime;
+				isNewFrame = true;
+			}
+		}
 
-				if (logOutgoingData->boolValue())
-				{
-					outActivityTrigger->trigger();
-					NLOG(niceName, "Sending Universe " << u->toString());
-				}
+		//Spread the universes over the frame, so a slow write or a large number of universes doesn't end up in one burst
+		bool sendOnChange = sendOnChangeOnly->boolValue();
+		const int numUniverses = sendingUniverses.size();
+		const int numSlices = jlimit(1, jmax(numUniverses, 1), sendSlices->intValue());
 
-				Array<uint8> values(u->values.getRawDataPointer(), u->values.size());
-				dmxInterfaceNotifier.addMessage(new DMXInterfaceEvent(DMXInterfaceEvent::UNIVERSE_SENT, u, values));
+		double maxLatency = 0;
+		int numSent = 0;
+		for (int slice = 0; slice < numSlices && !threadShouldExit(); slice++)
+		{
+			double msToSlice = loopStartTime + slice * rateMS / numSlices - Time::getMillisecondCounterHiRes();
+			if (msToSlice >= 1) wait((int)msToSlice);
 
+			const int start = slice * numUniverses / numSlices;
+			const int end = (slice + 1) * numUniverses / numSlices;
+			for (int i = start; i < end; i++)
+			{
+				double latency = sendUniverse(sendingUniverses[i], sendOnChange, isNewFrame ? frameTime : 0);
+				if (latency >= 0) numSent++;
+				maxLatency = jmax(maxLatency, latency);
 			}
 		}
 
+		//only after the last slice, so every universe of this frame is out before the sync
+		if (numSent > 0 && sendSync->boolValue() && !threadShouldExit()) sendSyncPacket();
+
+		if (isNewFrame && numSent > 0) sendLatency->setValue(maxLatency);
 
 		double t = Time::getMillisecondCounterHiRes();
 		double diffTime = t - loopStartTime;
-		double rateMS = 1000.0 / sendRate->intValue();
 
 		double msToWait = rateMS - diffTime;
 		if (msToWait > 0) wait(msToWait);
@@ -280,12 +376,255 @@ void DMXInterface::run()
 	}
 }
 
+double DMXInterface::sendUniverse(DMXFrame* f, bool sendOnChange, double frameTime)
+{
+	DMXUniverse* u = f->universe.get();
+	const int index = DMXUniverse::getUniverseIndex(u->net, u->subnet, u->universe);
+
+	double sendStartTime = Time::getMillisecondCounterHiRes();
+
+	if (sendOnChange && (f->isSent || f->dirtyRange.isEmpty()))
+	{
+		//unchanged, only refresh it at the keep alive rate
+		const int keepAlive = keepAliveTime->intValue();
+		if (keepAlive == 0) return -1;
+
+		GenericScopedLock lock(statsLock);
+		if (sendStartTime - universeStats[index].lastSendTime < keepAlive) return -1;
+	}
+
+	{
+		GenericScopedLock lock(deviceLock);
+		if (dmxDevice != nullptr)
+		{
+			if (dmxDevice->type == DMXDevice::SACN && sendSync->boolValue())
+			{
+				//sending changes only, the channels after the last changed one are left out of the packet. Keep alive refreshes send the full universe
+				const bool changesOnly = sendOnChange && !f->isSent && !f->dirtyRange.isEmpty();
+				sendSACNUniverse(u, changesOnly ? f->dirtyRange.getEnd() : DMX_NUM_CHANNELS);
+			}
+			else dmxDevice->sendDMXValues(u);
+		}
+	}
+	double sentTime = Time::getMillisecondCounterHiRes();
+	f->isSent = true;
+
+	double latency = frameTime > 0 ? sentTime - frameTime : 0;
+	{
+		GenericScopedLock lock(statsLock);
+		UniverseStats& stats = universeStats.getReference(index);
+		stats.sendTime = sentTime - sendStartTime;
+		stats.lastSendTime = sentTime;
+		stats.maxSendTime = jmax(stats.maxSendTime, stats.sendTime);
+		if (frameTime > 0) stats.latency = latency;
+		stats.sentFrames++;
+	}
+
+	if (logOutgoingData->boolValue())
+	{
+		outActivityTrigger->trigger();
+		NLOG(niceName, "Sending Universe " << u->toString() << " (" << String(sentTime - sendStartTime, 2) << " ms)");
+	}
+
+	dmxInterfaceNotifier.addMessage(new DMXInterfaceEvent(DMXInterfaceEvent::UNIVERSE_SENT, f));
+
+	return latency;
+}
+
+void DMXInterface::sendSACNUniverse(DMXUniverse* u, int numChannels)
+{
+	//sACN universes are only set by the universe parameter, net and subnet are not used
+	const int universe = u->universe;
+	uint8 sequence = sacnSequences.contains(universe) ? sacnSequences[universe] : 0;
+	sacnSequences.set(universe, sequence + 1);
+
+	SACNOutput out = getSACNOutput();
+	const int packetSize = writeSACNDataPacket(sacnPacket, syncCID, out.sourceName, out.priority, universe, syncUniverse->intValue(), sequence, u->values.getRawDataPointer(), numChannels);
+
+	String host = out.multicast ? "239.255." + String((universe >> 8) & 0xFF) + "." + String(universe & 0xFF) : out.host;
+	if (syncSender.write(host, out.port, sacnPacket, packetSize) == -1) NLOGWARNING(niceName, "Could not send universe " << universe << " to " << host);
+}
+
+void DMXInterface::sendSyncPacket()
+{
+	DMXDevice::Type type;
+	SACNOutput out;
+	{
+		GenericScopedLock lock(deviceLock);
+		if (dmxDevice == nullptr) return;
+		type = dmxDevice->type;
+		if (type == DMXDevice::SACN) out = getSACNOutput();
+	}
+
+	uint8 packet[sacnSyncPacketSize];
+	int packetSize = 0;
+	int port = 0;
+	String host;
+
+	if (type == DMXDevice::ARTNET)
+	{
+		//ArtSync : ID, OpCode 0x5200 (little endian), protocol version 14, 2 aux bytes
+		const uint8 header[] = { 'A', 'r', 't', '-', 'N', 'e', 't', 0, 0x00, 0x52, 0, 14, 0, 0 };
+		memcpy(packet, header, sizeof(header));
+		packetSize = sizeof(header);
+		port = 6454;
+		host = getSyncTarget(port, "255.255.255.255");
+	}
+	else if (type == DMXDevice::SACN)
+	{
+		const int syncAddress = syncUniverse->intValue();
+		writeSACNSyncPacket(packet, syncCID, syncAddress, syncSequence++);
+		packetSize = sacnSyncPacketSize;
+		port = out.port;
+		host = getSyncTarget(port, out.multicast ? "239.255." + String((syncAddress >> 8) & 0xFF) + "." + String(syncAddress & 0xFF) : out.host);
+	}
+
+	if (packetSize == 0) return;
+
+	int dataSent = syncSender.write(host, port, packet, packetSize);
+	if (dataSent == -1) NLOGWARNING(niceName, "Could not send sync packet to " << host);
+	else if (logOutgoingData->boolValue()) NLOG(niceName, "Sending Sync to " << host);
+}
+
+String DMXInterface::getSyncTarget(int& port, const String& defaultHost)
+{
+	String host = syncHost->stringValue().trim();
+	if (host.isEmpty()) return defaultHost;
+
+	if (host.containsChar(':'))
+	{
+		port = host.fromLastOccurrenceOf(":", false, false).getIntValue();
+		host = host.upToLastOccurrenceOf(":", false, false);
+	}
+
+	return host;
+}
+
+void DMXInterface::resolveSACNOutputParams()
+{
+	const bool isSACN = dmxDevice != nullptr && dmxDevice->type == DMXDevice::SACN;
+	sacnMulticastParam = isSACN ? findDeviceParameter({ "multicast" }, true) : nullptr;
+	sacnHostParam = isSACN ? findDeviceParameter({ "remoteHost", "outputHost" }) : nullptr;
+	sacnPortParam = isSACN ? findDeviceParameter({ "remotePort", "outputPort" }) : nullptr;
+	sacnPriorityParam = isSACN ? findDeviceParameter({ "priority" }) : nullptr;
+	sacnSourceNameParam = isSACN ? findDeviceParameter({ "nodeName", "sourceName" }) : nullptr;
+}
+
+Parameter* DMXInterface::findDeviceParameter(const StringArray& shortNames, bool matchStart)
+{
+	for (auto& p : dmxDevice->getAllParameters(true))
+	{
+		for (auto& n : shortNames)
+		{
+			if (matchStart ? p->shortName.startsWith(n) : p->shortName == n) return p;
+		}
+	}
+
+	return nullptr;
+}
+
+DMXInterface::SACNOutput DMXInterface::getSACNOutput()
+{
+	SACNOutput out;
+	if (sacnMulticastParam != nullptr) out.multicast = sacnMulticastParam->boolValue();
+	else out.multicast = sacnHostParam == nullptr;
+	if (sacnHostParam != nullptr) out.host = sacnHostParam->stringValue();
+	if (sacnPortParam != nullptr) out.port = sacnPortParam->intValue();
+	if (sacnPriorityParam != nullptr) out.priority = jlimit(0, 200, sacnPriorityParam->intValue());
+	if (sacnSourceNameParam != nullptr && sacnSourceNameParam->stringValue().isNotEmpty()) out.sourceName = sacnSourceNameParam->stringValue();
+	return out;
+}
+
+int DMXInterface::writeSACNDataPacket(uint8* packet, const uint8* cid, const String& sourceName, int priority, int universe, int syncAddress, uint8 sequence, const uint8* values, int numChannels)
+{
+	//E1.31 data packet : root layer, data framing layer with the synchronization address, DMP layer with start code and channels.
+	//The DMP property count can be lower than a full universe, then the packet stops after numChannels
+	numChannels = jlimit(1, DMX_NUM_CHANNELS, numChannels);
+	const int packetSize = sacnDataHeaderSize + numChannels;
+	memset(packet, 0, packetSize);
+
+	const uint8 root[] = { 0x00, 0x10, 0x00, 0x00, 'A', 'S', 'C', '-', 'E', '1', '.', '1', '7', 0, 0, 0 };
+	memcpy(packet, root, sizeof(root));
+	ByteOrder::writeBigEndianShort(0x7000 | (packetSize - 16), packet + 16);
+	ByteOrder::writeBigEndianInt(0x00000004, packet + 18);
+	memcpy(packet + 22, cid, 16);
+
+	uint8* framing = packet + 38;
+	ByteOrder::writeBigEndianShort(0x7000 | (packetSize - 38), framing);
+	ByteOrder::writeBigEndianInt(0x00000002, framing + 2);
+	sourceName.copyToUTF8((CharPointer_UTF8::CharType*)(framing + 6), 64);
+	framing[70] = (uint8)priority;
+	ByteOrder::writeBigEndianShort((uint16)syncAddress, framing + 71);
+	framing[73] = sequence;
+	framing[74] = 0; //options
+	ByteOrder::writeBigEndianShort((uint16)universe, framing + 75);
+
+	uint8* dmp = packet + 115;
+	ByteOrder::writeBigEndianShort(0x7000 | (packetSize - 115), dmp);
+	dmp[2] = 0x02;
+	dmp[3] = 0xA1;
+	ByteOrder::writeBigEndianShort(0x0000, dmp + 4); //first property address
+	ByteOrder::writeBigEndianShort(0x0001, dmp + 6); //address increment
+	ByteOrder::writeBigEndianShort((uint16)(numChannels + 1), dmp + 8);
+	dmp[10] = 0; //start code
+	memcpy(dmp + 11, values, numChannels);
+
+	return packetSize;
+}
+
+void DMXInterface::writeSACNSyncPacket(uint8* packet, const uint8* cid, int syncAddress, uint8 sequence)
+{
+	//E1.31 synchronization packet : root layer with the extended vector, then the sync framing layer
+	const uint8 root[] = { 0x00, 0x10, 0x00, 0x00, 'A', 'S', 'C', '-', 'E', '1', '.', '1', '7', 0, 0, 0, 0x70, 0x21, 0x00, 0x00, 0x00, 0x08 };
+	memcpy(packet, root, sizeof(root));
+	memcpy(packet + 22, cid, 16);
+
+	uint8* framing = packet + 38;
+	framing[0] = 0x70;
+	framing[1] = 0x0B;
+	framing[2] = 0x00;
+	framing[3] = 0x00;
+	framing[4] = 0x00;
+	framing[5] = 0x01;
+	framing[6] = sequence;
+	framing[7] = (uint8)((syncAddress >> 8) & 0xFF);
+	framing[8] = (uint8)(syncAddress & 0xFF);
+	framing[9] = 0;
+	framing[10] = 0;
+}
+
 InterfaceUI* DMXInterface::createUI()
 {
 	return new DMXInterfaceUI(this);
 }
 
 
+// DMX FRAME
+DMXInterface::DMXFrame::DMXFrame(DMXUniverse* u, DMXFrame* previous) :
+	universe(new DMXUniverse(u)),
+	isSent(false)
+{
+	const int numChannels = universe->values.size();
+	if (previous == nullptr || previous->universe->values.size() != numChannels)
+	{
+		dirtyRange = Range<int>(0, numChannels);
+		return;
+	}
+
+	const uint8* v = universe->values.getRawDataPointer();
+	const uint8* pv = previous->universe->values.getRawDataPointer();
+
+	int start = 0;
+	while (start < numChannels && v[start] == pv[start]) start++;
+	if (start == numChannels) return;
+
+	int end = numChannels;
+	while (end > start && v[end - 1] == pv[end - 1]) end--;
+
+	dirtyRange = Range<int>(start, end);
+}
+
+
 // DMX PARAMS
 DMXInterface::DMXParams::DMXParams() :
 	ControllableContainer("DMX Params")
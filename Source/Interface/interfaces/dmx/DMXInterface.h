@@ -32,6 +32,46 @@ public:
 
 	IntParameter* sendRate;
 	BoolParameter* sendOnChangeOnly;
+	IntParameter* sendSlices;
+	IntParameter* keepAliveTime;
+
+	//Sync packets (ArtSync / E1.31 universe synchronization) are sent once all the universes of a frame are written,
+	//so receivers in sync mode output the whole frame at once
+	BoolParameter* sendSync;
+	IntParameter* syncUniverse;
+	StringParameter* syncHost;
+
+	//with sACN sync, data packets are built here instead of by the device, their framing layer has to carry the sync address
+	static const int sacnPort = 5568;
+	static const int sacnDataHeaderSize = 126;
+	static const int sacnDataPacketSize = sacnDataHeaderSize + DMX_NUM_CHANNELS; //full universe, changes only packets stop after the last changed channel
+	static const int sacnSyncPacketSize = 49;
+
+	DatagramSocket syncSender;
+	uint8 syncSequence;
+	uint8 syncCID[16];
+	HashMap<int, uint8> sacnSequences; //per universe, only used by the sender thread
+	uint8 sacnPacket[sacnDataPacketSize];
+
+	//output settings of the sACN device, resolved by name when the device changes so the packets built here
+	//go where the device would send them, with its priority and source name. Only used with deviceLock held
+	struct SACNOutput
+	{
+		bool multicast = true;
+		String host;
+		int port = sacnPort;
+		int priority = 100;
+		String sourceName = ProjectInfo::projectName;
+	};
+
+	WeakReference<Parameter> sacnMulticastParam;
+	WeakReference<Parameter> sacnHostParam;
+	WeakReference<Parameter> sacnPortParam;
+	WeakReference<Parameter> sacnPriorityParam;
+	WeakReference<Parameter> sacnSourceNameParam;
+
+	FloatParameter* sendLatency;
+	IntParameter* droppedFrames;
 
 	IntParameter* defaultNet;
 	IntParameter* defaultSubnet;
@@ -40,7 +80,46 @@ public:
 	OwnedArray<DMXUniverse> universes;
 	HashMap<int, DMXUniverse*> universeIdMap; //internally used
 
-	OwnedArray<DMXUniverse, CriticalSection> universesToSend;
+	//Copy of a universe as computed for one frame. Values are not modified after creation,
+	//so the sender thread and the async listeners can share it without copying.
+	class DMXFrame :
+		public ReferenceCountedObject
+	{
+	public:
+		DMXFrame(DMXUniverse* u, DMXFrame* previous);
+		~DMXFrame() {}
+
+		typedef ReferenceCountedObjectPtr<DMXFrame> Ptr;
+
+		std::unique_ptr<DMXUniverse> universe;
+		Range<int> dirtyRange; //channels that changed since the previous frame of this universe, including the changes of frames that were never sent
+		bool isSent; //only used by the sender thread
+	};
+
+	HashMap<int, DMXFrame::Ptr> lastFrames; //internally used
+
+	//Frames are handed to the sender thread through universesToSend, the thread swaps them into sendingUniverses
+	//so slow device writes never hold the lock finishSendValues waits on.
+	ReferenceCountedArray<DMXFrame, CriticalSection> universesToSend;
+	ReferenceCountedArray<DMXFrame> sendingUniverses;
+	bool hasNewFrame;
+	double frameReadyTime;
+
+	struct UniverseStats
+	{
+		double sendTime = 0; //ms spent in the device write
+		double maxSendTime = 0;
+		double latency = 0; //ms between the frame being ready and this universe being written
+		int sentFrames = 0;
+		double lastSendTime = 0;
+		int droppedFrames = 0; //frames with changes replaced by a newer one before being sent
+	};
+
+	SpinLock statsLock;
+	HashMap<int, UniverseStats> universeStats;
+
+	UniverseStats getUniverseStats(int net, int subnet, int universe);
+	void resetStats();
 
 	void clearItem() override;
 
@@ -64,6 +143,17 @@ public:
 	DMXUniverse* getUniverse(int net, int subnet, int universe, bool createIfNotExist = true);
 
 	void run() override;
+	double sendUniverse(DMXFrame* f, bool sendOnChange, double frameTime);
+	void sendSACNUniverse(DMXUniverse* u, int numChannels);
+	void sendSyncPacket();
+	String getSyncTarget(int& port, const String& defaultHost);
+
+	void resolveSACNOutputParams();
+	Parameter* findDeviceParameter(const StringArray& shortNames, bool matchStart = false);
+	SACNOutput getSACNOutput();
+
+	static int writeSACNDataPacket(uint8* packet, const uint8* cid, const String& sourceName, int priority, int universe, int syncAddress, uint8 sequence, const uint8* values, int numChannels = DMX_NUM_CHANNELS);
+	static void writeSACNSyncPacket(uint8* packet, const uint8* cid, int syncAddress, uint8 sequence);
 
 	class DMXParams : public ControllableContainer
 	{
@@ -96,11 +186,11 @@ public:
 	public:
 		enum Type { DATA_IN_CHANGED, UNIVERSE_SENT };
 
-		DMXInterfaceEvent(Type t, DMXUniverse* universe, Array<uint8> values) : type(t), universe(universe), values(values) {}
+		DMXInterfaceEvent(Type t, DMXFrame::Ptr frame) : type(t), frame(frame), universe(frame->universe.get()) {}
 
 		Type type;
-		DMXUniverse* universe;
-		Array<uint8> values;
+		DMXFrame::Ptr frame;
+		DMXUniverse* universe; //owned by the frame, valid as long as the event is
 	};
 
 	QueuedNotifier<DMXInterfaceEvent> dmxInterfaceNotifier;
@@ -174,7 +174,7 @@ void DMXChannelView::newMessage(const DMXInterface::DMXInterfaceEvent& e)
 			&& e.universe->net == currentInterface->defaultNet->intValue()
 			&& e.universe->subnet == currentInterface->defaultSubnet->intValue())
 		{
-			for (int i = 0; i < DMX_NUM_CHANNELS; i++) channelItems[i]->value = e.values[i] / 255.0f;
+			for (int i = 0; i < DMX_NUM_CHANNELS; i++) channelItems[i]->value = e.universe->values[i] / 255.0f;
 			shouldRepaint = true;
 		}
 
@@ -11,7 +11,8 @@
 MIDIMapping::MIDIMapping() :
     BaseItem("MIDI Mapping"),
     isValid(false),
-    wasInRange(false)
+    wasInRange(false),
+    pendingValue(-1)
 {
     saveAndLoadRecursiveData = true;
 
@@ -20,7 +21,7 @@ MIDIMapping::MIDIMapping() :
 
     midiType = addEnumParameter("Type", "Sets the type to check");
     midiType->addOption("Note", NOTE)->addOption("Control Change", CONTROLCHANGE);
-    channel = addIntParameter("Channel", "The channel to use for this mapping.", 1, 1, 16);
+    channel = addIntParameter("Channel", "The channel to use for this mapping, 0 to accept messages from any channel.", 0, 0, 16);
     pitchOrNumber = addIntParameter("Pitch Or Number", "The pitch (for notes) or number (for controlChange) to use for this mapping.", 0, 0, 127);
 
     inputRange = addPoint2DParameter("Input Range", "The range to get from input");
@@ -43,35 +44,12 @@ MIDIMapping::~MIDIMapping()
 {
 }
 
-void MIDIMapping::handleNote(int channel, int pitch, int velocity)
+void MIDIMapping::learn(MidiType type, int _channel, int number)
 {
-    if (learnMode->boolValue())
-    {
-        midiType->setValueWithData(NOTE);
-        pitchOrNumber->setValue(pitch);
-        learnMode->setValue(false);
-    }
-
-    if (!enabled->boolValue()) return;
-
-    if (midiType->getValueDataAsEnum<MidiType>() != NOTE) return;
-    if (pitchOrNumber->intValue() != pitch) return;
-    handleValue(velocity);
-}
-
-void MIDIMapping::handleCC(int channel, int number, int value)
-{
-    if (learnMode->boolValue())
-    {
-        midiType->setValueWithData(CONTROLCHANGE);
-        pitchOrNumber->setValue(number);
-        learnMode->setValue(false);
-    }
-
-    if (!enabled->boolValue()) return;
-    if (midiType->getValueDataAsEnum<MidiType>() != CONTROLCHANGE) return;
-    if (pitchOrNumber->intValue() != number) return;
-    handleValue(value);
+    midiType->setValueWithData(type);
+    channel->setValue(_channel);
+    pitchOrNumber->setValue(number);
+    learnMode->setValue(false);
 }
 
 void MIDIMapping::handleValue(int value)
@@ -114,6 +92,19 @@ void MIDIMapping::handleValue(int value)
     }
 }
 
+var MIDIMapping::getJSONData()
+{
+    var data = BaseItem::getJSONData();
+    data.getDynamicObject()->setProperty("matchChannel", true);
+    return data;
+}
+
+void MIDIMapping::loadJSONDataItemInternal(var data)
+{
+    //the channel was ignored before mappings were matched on it, keep older shows reacting to all channels
+    if (!data.hasProperty("matchChannel")) channel->setValue(0);
+}
+
 InspectableEditor* MIDIMapping::getEditorInternal(bool isRoot, Array<Inspectable*> inspectables)
 {
     return new MIDIMappingEditor(this, isRoot);
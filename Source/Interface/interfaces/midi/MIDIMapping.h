@@ -22,7 +22,7 @@ public:
     
     enum MidiType { NOTE, CONTROLCHANGE };
     EnumParameter* midiType;
-    IntParameter* channel;
+    IntParameter* channel; //0 matches any channel
     IntParameter* pitchOrNumber;
 
     Point2DParameter* inputRange;
@@ -33,11 +33,15 @@ public:
     bool isValid;
     bool wasInRange;
 
+    std::atomic<int> pendingValue; //last continuous value received since the previous engine tick, -1 if none
+
     ActionManager actionManager;
 
-    void handleNote(int channel, int pitch, int velocity);
-    void handleCC(int channel, int number, int value);
+    void learn(MidiType type, int channel, int number);
     void handleValue(int value);
 
+    var getJSONData() override;
+    void loadJSONDataItemInternal(var data) override;
+
     InspectableEditor* getEditorInternal(bool isRoot, Array<Inspectable*> inspectables = {}) override;
 };
\ No newline at end of file
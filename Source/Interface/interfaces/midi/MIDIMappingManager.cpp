@@ -9,20 +9,130 @@
 */
 
 MIDIMappingManager::MIDIMappingManager() :
-    BaseManager("Mappings")
+    BaseManager("Mappings"),
+    dispatchDirty(true)
 {
+    EngineClock::getInstance()->addClockListener(this);
 }
 
 MIDIMappingManager::~MIDIMappingManager()
 {
+    if (EngineClock* clock = EngineClock::getInstanceWithoutCreating()) clock->removeClockListener(this);
+}
+
+int MIDIMappingManager::getDispatchSlot(MIDIMapping::MidiType type, int channel, int number)
+{
+    return ((int)type * 17 + jlimit(0, 16, channel)) * 128 + jlimit(0, 127, number);
+}
+
+void MIDIMappingManager::rebuildDispatchTable()
+{
+    //called with dispatchLock held
+    for (auto& s : usedDispatchSlots) dispatchTable[s].clearQuick();
+    usedDispatchSlots.clearQuick();
+    learningMappings.clearQuick();
+
+    for (auto& m : items)
+    {
+        if (m->learnMode->boolValue()) learningMappings.add(m);
+        if (!m->enabled->boolValue()) continue;
+
+        int slot = getDispatchSlot(m->midiType->getValueDataAsEnum<MIDIMapping::MidiType>(), m->channel->intValue(), m->pitchOrNumber->intValue());
+        if (dispatchTable[slot].isEmpty()) usedDispatchSlots.add(slot);
+        dispatchTable[slot].add(m);
+    }
+
+    dispatchDirty = false;
+}
+
+void MIDIMappingManager::dispatch(MIDIMapping::MidiType type, int channel, int number, int value)
+{
+    GenericScopedLock lock(dispatchLock);
+
+    if (dispatchDirty) rebuildDispatchTable();
+
+    if (!learningMappings.isEmpty())
+    {
+        for (auto& m : learningMappings) m->learn(type, channel, number);
+        rebuildDispatchTable();
+    }
+
+    const int slots[2] = { getDispatchSlot(type, channel, number), getDispatchSlot(type, 0, number) };
+    for (int slot : slots)
+    {
+        for (auto& m : dispatchTable[slot])
+        {
+            if (m->mode->getValueDataAsEnum<MIDIMapping::MappingMode>() != MIDIMapping::CONTINUOUS)
+            {
+                m->handleValue(value);
+                continue;
+            }
+
+            if (m->pendingValue.exchange(value) == -1)
+            {
+                GenericScopedLock pLock(pendingLock);
+                pendingMappings.add(m);
+            }
+        }
+    }
 }
 
 void MIDIMappingManager::handleNote(int channel, int pitch, int velocity)
 {
-    for (auto& i : items) i->handleNote(channel, pitch, velocity);
+    dispatch(MIDIMapping::NOTE, channel, pitch, velocity);
 }
 
 void MIDIMappingManager::handleCC(int channel, int number, int value)
 {
-    for (auto& i : items) i->handleCC(channel, number, value);
+    dispatch(MIDIMapping::CONTROLCHANGE, channel, number, value);
+}
+
+void MIDIMappingManager::addItemInternal(MIDIMapping* m, var data)
+{
+    dispatchDirty = true;
+}
+
+void MIDIMappingManager::addItemsInternal(Array<MIDIMapping*> mappings, var data)
+{
+    dispatchDirty = true;
+}
+
+void MIDIMappingManager::removeItemInternal(MIDIMapping* m)
+{
+    removeItemsInternal({ m });
+}
+
+void MIDIMappingManager::removeItemsInternal(Array<MIDIMapping*> mappings)
+{
+    //rebuild right away, mappings are deleted after this
+    {
+        GenericScopedLock lock(dispatchLock);
+        rebuildDispatchTable();
+    }
+
+    GenericScopedLock pLock(pendingLock);
+    for (auto& m : mappings) pendingMappings.removeAllInstancesOf(m);
+}
+
+void MIDIMappingManager::onControllableFeedbackUpdate(ControllableContainer* cc, Controllable* c)
+{
+    BaseManager::onControllableFeedbackUpdate(cc, c);
+
+    if (MIDIMapping* m = c->getParentAs<MIDIMapping>())
+    {
+        if (c == m->midiType || c == m->channel || c == m->pitchOrNumber || c == m->enabled || c == m->learnMode) dispatchDirty = true;
+    }
+}
+
+void MIDIMappingManager::clockTicked()
+{
+    //lock is kept while processing so a mapping can't be removed in the meantime
+    GenericScopedLock pLock(pendingLock);
+    for (auto& m : pendingMappings)
+    {
+        int value = m->pendingValue.exchange(-1);
+        if (value >= 0) m->handleValue(value);
+    }
+
+    pendingMappings.clearQuick();
 }
@@ -11,12 +11,38 @@
 #pragma once
 
 class MIDIMappingManager :
-    public BaseManager<MIDIMapping>
+    public BaseManager<MIDIMapping>,
+    public EngineClock::ClockListener
 {
 public:
     MIDIMappingManager();
     ~MIDIMappingManager();
 
+    //mappings indexed by (type, channel, number), rebuilt when a mapping is edited. Channel 0 holds the mappings for any channel
+    static const int numDispatchSlots = 2 * 17 * 128;
+    CriticalSection dispatchLock;
+    Array<MIDIMapping*> dispatchTable[numDispatchSlots];
+    Array<int> usedDispatchSlots;
+    Array<MIDIMapping*> learningMappings;
+    bool dispatchDirty;
+
+    //continuous mappings are only fired once per engine tick with their last value
+    CriticalSection pendingLock;
+    Array<MIDIMapping*> pendingMappings;
+
+    static int getDispatchSlot(MIDIMapping::MidiType type, int channel, int number);
+    void rebuildDispatchTable();
+    void dispatch(MIDIMapping::MidiType type, int channel, int number, int value);
+
     void handleNote(int channel, int pitch, int velocity);
     void handleCC(int channel, int number, int value);
-};
\ No newline at end of file
+
+    void addItemInternal(MIDIMapping* m, var data) override;
+    void addItemsInternal(Array<MIDIMapping*> mappings, var data) override;
+    void removeItemInternal(MIDIMapping* m) override;
+    void removeItemsInternal(Array<MIDIMapping*> mappings) override;
+
+    void onControllableFeedbackUpdate(ControllableContainer* cc, Controllable* c) override;
+
+    void clockTicked() override;
+};
@@ -10,6 +10,7 @@
 
 #include "Interface/InterfaceIncludes.h"
 #include "Object/ObjectIncludes.h"
+#include "Common/Serial/lib/cobs/cobs.h"
 
 SerialInterface::SerialInterface() :
 	Interface("Serial", true),
@@ -26,6 +27,10 @@ SerialInterface::SerialInterface() :
 	isConnected->isSavable = false;
 	//connectionFeedbackRef = isConnected;
 
+	outputMode = addEnumParameter("Output Mode", "Script calls sendValuesForObject in the interface scripts for each object. Binary modes send COBS framed packets directly, without scripting");
+	outputMode->addOption("Script", SCRIPT)->addOption("Binary Pixels", BINARY_PIXELS)->addOption("Binary Values", BINARY_VALUES);
+	useCRC = addBoolParameter("Use CRC", "If checked, a CRC-16/CCITT is appended to each binary packet so the receiver can drop corrupted frames", false);
+
 	scriptObject.getDynamicObject()->setMethod(sendId, SerialInterface::sendStringFromScript);
 	scriptObject.getDynamicObject()->setMethod(sendBytesId, SerialInterface::sendBytesFromScript);
 
@@ -133,8 +138,20 @@ void SerialInterface::onContainerParameterChangedInternal(Parameter* p)
 	}
 }
 
+void SerialInterface::prepareSendValues()
+{
+	frameBuffer.clearQuick();
+}
+
 void SerialInterface::sendValuesForObjectInternal(Object* o)
 {
+	OutputMode mode = outputMode->getValueDataAsEnum<OutputMode>();
+	if (mode != SCRIPT)
+	{
+		appendBinaryPacket(o, mode);
+		return;
+	}
+
 	Array<var> args;
 	args.add(o->getScriptObject());
 
@@ -144,7 +161,7 @@ void SerialInterface::sendValuesForObjectInternal(Object* o)
 		if (!c->enabled->boolValue()) continue;
 
 		var compData(new DynamicObject());
-		for (auto& p : c->computedParameters) compData.getDynamicObject()->setProperty(p->shortName, p->getValue());
+		for (auto& p : c->computedParameters) compData.getDynamicObject()->setProperty(p->shortName, c->getComputedValue(p));
 		valuesData.getDynamicObject()->setProperty(c->shortName, compData);
 	}
 	args.add(valuesData);
@@ -155,6 +172,100 @@ void SerialInterface::sendValuesForObjectInternal(Object* o)
 	scriptManager->callFunctionOnAllItems("sendValuesForObject", args);
 }
 
+void SerialInterface::finishSendValues()
+{
+	if (frameBuffer.isEmpty()) return;
+	if (port == nullptr || !port->isOpen()) return;
+
+	if (logOutgoingData->boolValue()) NLOG(niceName, "Sending " << frameBuffer.size() << " bytes of binary frames");
+
+	port->writeBytes(frameBuffer);
+}
+
+void SerialInterface::appendBinaryPacket(Object* o, OutputMode mode)
+{
+	if (port == nullptr || !port->isOpen()) return;
+
+	CustomSerialParams* serialParams = dynamic_cast<CustomSerialParams*>(o->interfaceParameters.get());
+	int targetID = serialParams != nullptr && serialParams->targetID != nullptr ? serialParams->targetID->intValue() : 0;
+	bool blackout = ObjectManager::getInstance()->blackOut->boolValue();
+
+	payloadBuffer.clearQuick();
+	payloadBuffer.add((uint8)(mode == BINARY_PIXELS ? PIXEL_PACKET : VALUES_PACKET));
+	payloadBuffer.add((uint8)(targetID & 0xFF));
+	payloadBuffer.add((uint8)((targetID >> 8) & 0xFF));
+	payloadBuffer.add(0); //count, filled below
+	payloadBuffer.add(0);
+
+	int count = 0;
+	for (auto& c : o->componentManager->items)
+	{
+		if (!c->enabled->boolValue()) continue;
+
+		if (mode == BINARY_PIXELS)
+		{
+			ColorComponent* cc = dynamic_cast<ColorComponent*>(c);
+			if (cc == nullptr) continue;
+
+			GenericScopedLock lock(cc->outColors.getLock());
+			for (auto& col : cc->outColors)
+			{
+				payloadBuffer.add(blackout ? 0 : col.getRed());
+				payloadBuffer.add(blackout ? 0 : col.getGreen());
+				payloadBuffer.add(blackout ? 0 : col.getBlue());
+			}
+			count += cc->outColors.size();
+		}
+		else
+		{
+			for (auto& p : c->computedParameters)
+			{
+				var v = c->getComputedValue(p);
+				if (!p->isComplex())
+				{
+					payloadBuffer.add(blackout ? 0 : (uint8)roundToInt(jlimit(0.f, 1.f, (float)v) * 255));
+					count++;
+				}
+				else
+				{
+					for (int i = 0; i < v.size(); i++) payloadBuffer.add(blackout ? 0 : (uint8)roundToInt(jlimit(0.f, 1.f, (float)v[i]) * 255));
+					count += v.size();
+				}
+			}
+		}
+	}
+
+	count = jmin(count, 0xFFFF);
+	payloadBuffer.set(3, (uint8)(count & 0xFF));
+	payloadBuffer.set(4, (uint8)((count >> 8) & 0xFF));
+
+	if (useCRC->boolValue())
+	{
+		uint16 crc = getCRC16(payloadBuffer.getRawDataPointer(), payloadBuffer.size());
+		payloadBuffer.add((uint8)(crc & 0xFF));
+		payloadBuffer.add((uint8)((crc >> 8) & 0xFF));
+	}
+
+	//COBS adds at most one byte every 254, plus the trailing delimiter
+	const int maxEncodedSize = payloadBuffer.size() + payloadBuffer.size() / 254 + 2;
+	const int frameStart = frameBuffer.size();
+	frameBuffer.insertMultiple(frameStart, 0, maxEncodedSize);
+
+	size_t encodedSize = cobs_encode(payloadBuffer.getRawDataPointer(), payloadBuffer.size(), frameBuffer.getRawDataPointer() + frameStart);
+	frameBuffer.removeRange(frameStart + (int)encodedSize + 1, maxEncodedSize - (int)encodedSize - 1); //keep one zero byte as frame delimiter
+}
+
+uint16 SerialInterface::getCRC16(const uint8* data, int numBytes)
+{
+	uint16 crc = 0xFFFF;
+	for (int i = 0; i < numBytes; i++)
+	{
+		crc ^= (uint16)data[i] << 8;
+		for (int b = 0; b < 8; b++) crc = (crc & 0x8000) ? (uint16)((crc << 1) ^ 0x1021) : (uint16)(crc << 1);
+	}
+	return crc;
+}
+
 void SerialInterface::serialDataReceived(SerialDevice*, const var& data)
 {
 	if (logIncomingData->boolValue())
@@ -172,7 +283,7 @@ void SerialInterface::sendMessage(const String& message, var)
 	port->writeString(message);
 }
 
-void SerialInterface::sendBytes(Array<uint8> data, var)
+void SerialInterface::sendBytes(const Array<uint8>& data, var)
 {
 	if (port == nullptr) return;
 
@@ -278,7 +389,8 @@ void SerialInterface::itemsRemoved(Array<GenericControllableItem*>)
 
 SerialInterface::CustomSerialParams::CustomSerialParams(SerialInterface* i) :
 	ControllableContainer("Interface Parameters"),
-	itf(i)
+	itf(i),
+	targetID(nullptr)
 {
 	if (itf != nullptr) itf->addSerialInterfaceListener(this);
 	rebuildArgsFromInterface();
@@ -304,6 +416,8 @@ void SerialInterface::CustomSerialParams::rebuildArgsFromInterface()
 	var oldData = getJSONData();
 	clear();
 
+	targetID = addIntParameter("Target ID", "Identifier of this object in binary packets, used by the receiver to route the data to the right output", 0, 0, 65535);
+
 	for (auto& gci : itf->customParams.items)
 	{
 		if (gci->controllable->type == Controllable::TRIGGER) continue;
@@ -28,6 +28,16 @@ public:
 	SerialDevice* port;
 	BoolParameter* isConnected;
 
+    //Binary output sends one COBS frame per object, all frames of a tick are written to the port at once.
+    //Frame payload (little endian) : uint8 packetType, uint16 targetID, uint16 count, count pixels (RGB) or values (8 bits), optional uint16 CRC-16/CCITT of the previous bytes
+    enum OutputMode { SCRIPT, BINARY_PIXELS, BINARY_VALUES };
+    enum PacketType { PIXEL_PACKET = 1, VALUES_PACKET = 2 };
+    EnumParameter* outputMode;
+    BoolParameter* useCRC;
+
+    Array<uint8> payloadBuffer;
+    Array<uint8> frameBuffer;
+
     GenericControllableManager customParams;
 
     const Identifier sendId = "send";
@@ -38,12 +48,17 @@ public:
 
 	virtual void onContainerParameterChangedInternal(Parameter* p) override;
 
+	virtual void prepareSendValues() override;
 	virtual void sendValuesForObjectInternal(Object* o) override;
+	virtual void finishSendValues() override;
+
+    void appendBinaryPacket(Object* o, OutputMode mode);
+    static uint16 getCRC16(const uint8* data, int numBytes);
 
     void serialDataReceived(SerialDevice*, const var&) override;
 
     virtual void sendMessage(const String& message, var params = var());
-    virtual void sendBytes(Array<uint8> bytes, var params = var());
+    virtual void sendBytes(const Array<uint8>& bytes, var params = var());
 
     static var sendStringFromScript(const var::NativeFunctionArgs& a);
     static var sendBytesFromScript(const var::NativeFunctionArgs& a);
@@ -83,6 +98,7 @@ public:
         ~CustomSerialParams();
 
         SerialInterface* itf;
+        IntParameter* targetID;
 
         void customParamsChanged(SerialInterface*);
         void rebuildArgsFromInterface();
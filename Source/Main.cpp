@@ -8,7 +8,7 @@ BluxApplication::BluxApplication() :
 {
 }
 
-void BluxApplication::initialiseInternal(const String&)
+void BluxApplication::initialiseInternal(const String& commandLine)
 {
     engine.reset(new BluxEngine());
 	mainComponent.reset(new MainComponent());
@@ -23,4 +23,23 @@ void BluxApplication::initialiseInternal(const String&)
 
 	ShapeShifterManager::getInstance()->setDefaultFileData(BinaryData::default_bluxlayout);
 	ShapeShifterManager::getInstance()->setLayoutInformations("bluxlayout", "Blux/layouts");
+
+	if (GoldenOutputTester::isGoldenTestCommandLine(commandLine))
+	{
+		//run once the app is fully started, then quit with the number of failed fixtures as exit code
+		MessageManager::callAsync([commandLine]()
+			{
+				int numFailed = GoldenOutputTester::runFromCommandLine(commandLine);
+				JUCEApplication::getInstance()->setApplicationReturnValue(numFailed);
+				JUCEApplication::quit(); //no save prompt for the fixture shows
+			});
+	}
+	else if (SyncLoopbackTester::isSyncTestCommandLine(commandLine))
+	{
+		MessageManager::callAsync([commandLine]()
+			{
+				JUCEApplication::getInstance()->setApplicationReturnValue(SyncLoopbackTester::runFromCommandLine(commandLine));
+				JUCEApplication::quit();
+			});
+	}
 }
@@ -30,6 +30,23 @@ namespace BluxCommandIDs
 	static const int loadPreviousScene = 0x801;
 	static const int saveCurrentScene = 0x802;
 
+	static const int saveBinaryShow = 0x900;
+	static const int openBinaryShow = 0x901;
+	static const int convertBinaryToJSON = 0x902;
+	static const int convertJSONToBinary = 0x903;
+	static const int recoverLastSession = 0x904;
+}
+
+static void chooseShowFile(const String& title, const String& pattern, bool saveMode, std::function<void(File)> callback)
+{
+	FileChooser* chooser = new FileChooser(title, File::getSpecialLocation(File::userDocumentsDirectory), pattern);
+	int flags = FileBrowserComponent::canSelectFiles | (saveMode ? FileBrowserComponent::saveMode | FileBrowserComponent::warnAboutOverwriting : FileBrowserComponent::openMode);
+	chooser->launchAsync(flags, [callback](const FileChooser& fc)
+		{
+			File f = fc.getResult();
+			delete& fc;
+			if (f != File()) callback(f);
+		});
 }
 
 void MainComponent::getCommandInfo(CommandID commandID, ApplicationCommandInfo& result) 
@@ -83,6 +100,26 @@ void MainComponent::getCommandInfo(CommandID commandID, ApplicationCommandInfo&
 		result.setInfo("Download Object Definitions", "", "General", result.readOnlyInKeyEditor);
 		break;
 
+	case BluxCommandIDs::saveBinaryShow:
+		result.setInfo("Save Binary Show...", "", "General", result.readOnlyInKeyEditor);
+		break;
+
+	case BluxCommandIDs::openBinaryShow:
+		result.setInfo("Open Binary Show...", "", "General", result.readOnlyInKeyEditor);
+		break;
+
+	case BluxCommandIDs::convertBinaryToJSON:
+		result.setInfo("Convert Binary Show to JSON...", "", "General", result.readOnlyInKeyEditor);
+		break;
+
+	case BluxCommandIDs::convertJSONToBinary:
+		result.setInfo("Convert JSON Show to Binary...", "", "General", result.readOnlyInKeyEditor);
+		break;
+
+	case BluxCommandIDs::recoverLastSession:
+		result.setInfo("Recover Last Session", "", "General", result.readOnlyInKeyEditor);
+		break;
+
 	case BluxCommandIDs::flashSelected:
 		result.setInfo("Flash selected Objects", "", "Blux", 0);
 		result.addDefaultKeypress(KeyPress::createFromDescription("f").getKeyCode(), ModifierKeys::noModifiers);
@@ -136,6 +173,11 @@ void MainComponent::getAllCommands(Array<CommandID>& commands) {
 		//BluxCommandIDs::goToCommunityModules,
 		BluxCommandIDs::reloadObjectDefinitions,
 		BluxCommandIDs::downloadObjectsDefinitions,
+		BluxCommandIDs::saveBinaryShow,
+		BluxCommandIDs::openBinaryShow,
+		BluxCommandIDs::convertBinaryToJSON,
+		BluxCommandIDs::convertJSONToBinary,
+		BluxCommandIDs::recoverLastSession,
 		BluxCommandIDs::exitGuide,
 		BluxCommandIDs::flashSelected,
 		BluxCommandIDs::loadNextScene,
@@ -195,6 +237,13 @@ void MainComponent::fillFileMenuInternal(PopupMenu & menu)
 	//menu.addCommandItem(&getCommandManager(), BluxCommandIDs::goToCommunityModules);
 	menu.addCommandItem(&getCommandManager(), BluxCommandIDs::reloadObjectDefinitions);
 	menu.addCommandItem(&getCommandManager(), BluxCommandIDs::downloadObjectsDefinitions);
+	menu.addSeparator();
+	menu.addCommandItem(&getCommandManager(), BluxCommandIDs::saveBinaryShow);
+	menu.addCommandItem(&getCommandManager(), BluxCommandIDs::openBinaryShow);
+	menu.addCommandItem(&getCommandManager(), BluxCommandIDs::convertBinaryToJSON);
+	menu.addCommandItem(&getCommandManager(), BluxCommandIDs::convertJSONToBinary);
+	menu.addSeparator();
+	menu.addCommandItem(&getCommandManager(), BluxCommandIDs::recoverLastSession);
 }
 
 bool MainComponent::perform(const InvocationInfo& info)
@@ -253,13 +302,47 @@ bool MainComponent::perform(const InvocationInfo& info)
 		break;
 
 	case BluxCommandIDs::reloadObjectDefinitions:
-		ObjectManager::getInstance()->updateFactoryDefinitions();
+		ObjectManager::getInstance()->updateFactoryDefinitions(true);
 		break;
 
 	case BluxCommandIDs::downloadObjectsDefinitions:
 		ObjectManager::getInstance()->downloadObjects();
 		break;
 
+	case BluxCommandIDs::saveBinaryShow:
+	{
+		BluxEngine* be = (BluxEngine*)Engine::mainEngine;
+		if (be->binaryShowFile.existsAsFile()) be->saveBinaryShow(be->binaryShowFile);
+		else chooseShowFile("Save binary show", "*.bluxb", true, [be](File f) { be->saveBinaryShow(f.withFileExtension("bluxb")); });
+	}
+	break;
+
+	case BluxCommandIDs::openBinaryShow:
+		chooseShowFile("Open binary show", "*.bluxb", false, [](File f) { ((BluxEngine*)Engine::mainEngine)->loadBinaryShow(f); });
+		break;
+
+	case BluxCommandIDs::convertBinaryToJSON:
+		chooseShowFile("Convert binary show to JSON", "*.bluxb", false, [](File f)
+			{
+				File jsonFile = f.withFileExtension("blux").getNonexistentSibling();
+				if (BinaryShowFile::convertToJSON(f, jsonFile)) LOG("Converted " << f.getFileName() << " to " << jsonFile.getFileName());
+				else LOGERROR("Could not convert " << f.getFileName() << " to JSON");
+			});
+		break;
+
+	case BluxCommandIDs::convertJSONToBinary:
+		chooseShowFile("Convert JSON show to binary", "*.blux;*.json", false, [](File f)
+			{
+				File binaryFile = f.withFileExtension("bluxb");
+				if (BinaryShowFile::convertToBinary(f, binaryFile)) LOG("Converted " << f.getFileName() << " to " << binaryFile.getFileName());
+				else LOGERROR("Could not convert " << f.getFileName() << " to binary");
+			});
+		break;
+
+	case BluxCommandIDs::recoverLastSession:
+		if (ShowJournal* journal = ((BluxEngine*)Engine::mainEngine)->showJournal.get()) journal->recover();
+		break;
+
 	case BluxCommandIDs::loadNextScene:
 		SceneManager::getInstance()->loadNextSceneTrigger->trigger();
 		break;
@@ -25,4 +25,10 @@
 #include "UI/AssetManager.cpp"
 #include "UI/BluxInspector.cpp"
 #include "Engine/BluxEngine.cpp"
-#include "Engine/GenericAction.cpp"
\ No newline at end of file
+#include "Engine/GenericAction.cpp"
+#include "Engine/VizStreamer.cpp"
+#include "Engine/BinaryShowFile.cpp"
+#include "Engine/ShowJournal.cpp"
+#include "Engine/OfflineRenderer.cpp"
+#include "Engine/GoldenOutputTester.cpp"
+#include "Engine/SyncLoopbackTester.cpp"
\ No newline at end of file
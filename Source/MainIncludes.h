@@ -20,5 +20,11 @@
 #include "UI/AssetManager.h"
 #include "UI/BluxInspector.h"
 
+#include "Engine/VizStreamer.h"
+#include "Engine/BinaryShowFile.h"
+#include "Engine/ShowJournal.h"
+#include "Engine/OfflineRenderer.h"
+#include "Engine/GoldenOutputTester.h"
+#include "Engine/SyncLoopbackTester.h"
 #include "Engine/BluxEngine.h"
 #include "Engine/GenericAction.h"
\ No newline at end of file
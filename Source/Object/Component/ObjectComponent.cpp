@@ -11,6 +11,29 @@
 #include "Object/ObjectIncludes.h"
 #include "Interface/InterfaceIncludes.h"
 
+ComputedValueSnapshot::ComputedValueSnapshot() :
+	writeIndex(0),
+	readIndex(2),
+	middleIndex(1)
+{
+}
+
+void ComputedValueSnapshot::publish()
+{
+	writeIndex = middleIndex.exchange(writeIndex | freshBit) & 3;
+}
+
+bool ComputedValueSnapshot::pull()
+{
+	if ((middleIndex.load() & freshBit) == 0) return false;
+	readIndex = middleIndex.exchange(readIndex) & 3;
+	return true;
+}
+
+int ObjectComponent::numSlots = 0;
+Array<int> ObjectComponent::freeSlots;
+SpinLock ObjectComponent::slotLock;
+
 ObjectComponent::ObjectComponent(Object* o, String name, ComponentType componentType, var params) :
 	BaseItem(name, true),
 	object(o),
@@ -27,10 +50,15 @@ ObjectComponent::ObjectComponent(Object* o, String name, ComponentType component
 
 	interfaceParamCC.hideInEditor = interfaceParams.isEmpty();
 	addChildControllableContainer(&interfaceParamCC);
+
+	SpinLock::ScopedLockType lock(slotLock);
+	slot = freeSlots.isEmpty() ? numSlots++ : freeSlots.removeAndReturn(freeSlots.size() - 1);
 }
 
 ObjectComponent::~ObjectComponent()
 {
+	SpinLock::ScopedLockType lock(slotLock);
+	freeSlots.add(slot);
 }
 
 void ObjectComponent::rebuildInterfaceParams(Interface* interface)
@@ -163,8 +191,80 @@ void ObjectComponent::updateComputedValues(HashMap<Parameter*, var>& values)
 	for (auto& p : computedParameters)
 	{
 		//DBG("update computed value after chain, " << p->niceName << " : " << values[p].toString());
-		p->setValue(values[p]);
+		if (values.contains(p)) computedValues.set(p, values[p]);
+	}
+
+	writeComputedSnapshot();
+}
+
+var ObjectComponent::getComputedValue(Parameter* p) const
+{
+	//before the first compute, the parameter still holds its initial value
+	if (computedValues.contains(p)) return computedValues[p];
+	return p->getValue();
+}
+
+void ObjectComponent::writeComputedSnapshot()
+{
+	//layout is [size, values...] for each computed parameter, so the reader doesn't need to touch the parameters
+	Array<float>& buffer = computedSnapshot.getWriteBuffer();
+	buffer.clearQuick();
+	for (auto& p : computedParameters)
+	{
+		var v = getComputedValue(p);
+		if (!v.isArray())
+		{
+			buffer.add(1);
+			buffer.add((float)v);
+		}
+		else
+		{
+			int size = v.size();
+			buffer.add(size);
+			for (int i = 0; i < size; i++) buffer.add(v[i]);
+		}
+	}
+
+	Array<float>& vizBuffer = vizSnapshot.getWriteBuffer();
+	vizBuffer.clearQuick();
+	vizBuffer.addArray(buffer);
+
+	computedSnapshot.publish();
+	vizSnapshot.publish();
+}
+
+void ObjectComponent::publishComputedValues()
+{
+	if (!computedSnapshot.pull()) return;
+
+	const Array<float>& buffer = computedSnapshot.getReadBuffer();
+	const bool sameLayout = buffer.size() == publishedValues.size();
+
+	int index = 0;
+	for (auto& p : computedParameters)
+	{
+		if (index >= buffer.size()) break;
+		int size = (int)buffer[index];
+		int end = jmin(index + 1 + size, buffer.size());
+
+		bool changed = !sameLayout;
+		for (int i = index; i < end && !changed; i++) changed = buffer.getUnchecked(i) != publishedValues.getUnchecked(i);
+
+		if (changed)
+		{
+			if (!p->isComplex()) p->setValue(buffer[index + 1]);
+			else
+			{
+				var v;
+				for (int i = index + 1; i < end; i++) v.append(buffer.getUnchecked(i));
+				p->setValue(v);
+			}
+		}
+
+		index = end;
 	}
+
+	publishedValues = buffer;
 }
 
 void ObjectComponent::setupFromJSONDefinition(var data)
@@ -249,7 +349,7 @@ void ObjectComponent::fillInterfaceDataInternal(Interface* i, var data, var para
 			var mappedVal = getMappedValueForComputedParam(i, cp);
 			if (cp->isComplex())
 			{
-				var val = cp->getValue();
+				var val = getComputedValue(cp);
 				for (int i = 0; i < val.size(); i++) channelsData[targetChannel + i] = blackout ? 0.f : (float)mappedVal[i];
 			}
 			else
@@ -264,7 +364,7 @@ void ObjectComponent::fillInterfaceDataInternal(Interface* i, var data, var para
 		if (valData == nullptr) return;
 
 		var cData(new DynamicObject());
-		for (auto& p : computedParameters) cData.getDynamicObject()->setProperty(p->shortName, p->getValue());
+		for (auto& p : computedParameters) cData.getDynamicObject()->setProperty(p->shortName, getComputedValue(p));
 		valData->setProperty(shortName, cData);
 	}
 }
@@ -289,12 +389,13 @@ var ObjectComponent::getMappedValueForComputedParam(Interface* i, Parameter* cp)
 	if (DMXInterface* di = dynamic_cast<DMXInterface*>(i))
 	{
 
-		if (cp->type == Controllable::FLOAT)  return cp->floatValue() * 255;
-		else if (cp->type == Controllable::INT) return cp->intValue();
+		var val = getComputedValue(cp);
+		if (cp->type == Controllable::FLOAT)  return (float)val * 255;
+		else if (cp->type == Controllable::INT) return (int)val;
 
 		if (cp->isComplex())
 		{
-			var result = cp->getValue().clone();
+			var result = val.clone();
 			for (int i = 0; i < result.size(); i++)
 			{
 				result[i] = (float)result[i] * 255;
@@ -306,7 +407,7 @@ var ObjectComponent::getMappedValueForComputedParam(Interface* i, Parameter* cp)
 	}
 
 
-	return cp->getValue();
+	return getComputedValue(cp);
 }
 
 var ObjectComponent::getJSONData()
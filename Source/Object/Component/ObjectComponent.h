@@ -13,6 +13,27 @@
 class Object;
 class Interface;
 
+//Lock-free triple buffer, the compute thread writes and publishes a full set of values, a single reader pulls the latest one
+class ComputedValueSnapshot
+{
+public:
+    ComputedValueSnapshot();
+
+    Array<float>& getWriteBuffer() { return buffers[writeIndex]; }
+    const Array<float>& getReadBuffer() const { return buffers[readIndex]; }
+
+    void publish();
+    bool pull(); //returns false if nothing was published since the last pull
+
+private:
+    static const int freshBit = 4;
+
+    Array<float> buffers[3];
+    int writeIndex;
+    int readIndex;
+    std::atomic<int> middleIndex; //buffer shared between writer and reader, with freshBit set when it holds unread values
+};
+
 class ObjectComponent :
     public BaseItem
 {
@@ -23,6 +44,12 @@ public:
     
     Object* object;
 
+    //dense index reused across components, allows effects to store per-component state in arrays instead of hashmaps
+    int slot;
+    static int numSlots;
+    static Array<int> freeSlots;
+    static SpinLock slotLock;
+
     Parameter* mainParameter;
 
     ComponentType componentType;
@@ -41,6 +68,14 @@ public:
 
     Array<WeakReference<Parameter>> sceneDataParameters;
 
+    //computed values are only stored here and in the snapshot by the compute thread, the computed parameters are set from the snapshot on the message thread by publishComputedValues
+    HashMap<Parameter*, var> computedValues;
+    ComputedValueSnapshot computedSnapshot;
+    ComputedValueSnapshot vizSnapshot; //same values, read by the VizStreamer thread
+    Array<float> publishedValues;
+
+    var getComputedValue(Parameter* p) const; //to use on the compute thread instead of p->getValue()
+
     void rebuildInterfaceParams(Interface* i);
     virtual bool checkDefaultInterfaceParamEnabled(Parameter* p) { return true; }
 
@@ -53,6 +88,8 @@ public:
 
     virtual void fillComputedValueMap(HashMap<Parameter*, var>& values);
     virtual void updateComputedValues(HashMap<Parameter*, var>& values);
+    void writeComputedSnapshot();
+    void publishComputedValues();
 
     virtual void setupFromJSONDefinition(var data);
 
@@ -70,6 +70,9 @@ void ColorComponent::setupShape(const String& type)
 {
 	if (type == "Line") pixelShape.reset(new LinePixelShape(resolution->intValue()));
 	else if (type == "Circle") pixelShape.reset(new CirclePixelShape(resolution->intValue()));
+	else if (type == "Grid") pixelShape.reset(new GridPixelShape(resolution->intValue()));
+	else if (type == "Polyline") pixelShape.reset(new PolylinePixelShape(resolution->intValue()));
+	else if (type == "CSV") pixelShape.reset(new CSVPixelShape(resolution->intValue()));
 	else pixelShape.reset(new PointPixelShape(resolution->intValue()));
 
 	colorComponentNotifier.addMessage(new ColorComponentEvent(ColorComponentEvent::SHAPE_CHANGED, this));
@@ -155,7 +158,7 @@ void ColorComponent::updateComputedValues(HashMap<Parameter*, var>& values)
 			{
 				dimmerComponent = dynamic_cast<DimmerComponent*>(object->getComponentForType(ComponentType::DIMMER));
 			}
-			if (dimmerComponent != nullptr) mult = dimmerComponent->mainParameter->floatValue();
+			if (dimmerComponent != nullptr) mult = dimmerComponent->getComputedValue(dimmerComponent->mainParameter);
 		}
 
 		for (int i = 0; i < colValues.size(); i++)
@@ -174,8 +177,10 @@ void ColorComponent::updateComputedValues(HashMap<Parameter*, var>& values)
 
 	if (colValues.size() > 0 && colValues[0].size() >= 4)
 	{
-		paramComputedMap[mainColor]->setValue(colValues[0]);
+		computedValues.set(paramComputedMap[mainColor], colValues[0]);
 	}
+
+	writeComputedSnapshot();
 }
 
 
@@ -219,45 +224,65 @@ void ColorComponent::fillInterfaceDataInternal(Interface* i, var data, var param
 
 		int temp = whiteTemperature->intValue();
 
-		for (int i = 0; i < outColors.size(); i++)
-		{
-			var c;
+		int numPixels = outColors.size();
+		if (rgbBuffer.size() != numPixels * 3) rgbBuffer.resize(numPixels * 3);
+		if (convertedBuffer.size() != numPixels * 5) convertedBuffer.resize(numPixels * 5);
 
-			switch (cm)
-			{
+		float* rgb = rgbBuffer.getRawDataPointer();
+		float* converted = convertedBuffer.getRawDataPointer();
 
-			case HS:
-			{
-				float h, s, b;
-				outColors[i].getHSB(h, s, b);
+		for (int i = 0; i < numPixels; i++)
+		{
+			Colour col = outColors[i];
+			rgb[i * 3] = col.getFloatRed();
+			rgb[i * 3 + 1] = col.getFloatGreen();
+			rgb[i * 3 + 2] = col.getFloatBlue();
+		}
 
-				c.append(h);
-				c.append(s);
-			}
+		switch (cm)
+		{
+		case RGBW:
+		case WRGB:
+			ColorHelpers::getRGBWFromRGB(rgb, converted, numPixels, temp);
 			break;
 
-			case RGBW:
-			case WRGB:
-				c = ColorHelpers::getRGBWFromRGB(outColors[i], temp);
-				break;
-
-			case RGBAW:
-			case RGBWA:
-				c = ColorHelpers::getRGBWAFromRGB(outColors[i], temp);
-				break;
+		case RGBAW:
+		case RGBWA:
+			ColorHelpers::getRGBWAFromRGB(rgb, converted, numPixels, temp);
+			break;
 
-			case CMY:
-				c.append(1 - outColors[i].getFloatRed());
-				c.append(1 - outColors[i].getFloatGreen());
-				c.append(1 - outColors[i].getFloatBlue());
-				break;
+		default:
+			for (int i = 0; i < numPixels; i++)
+			{
+				float* c = converted + i * 5;
+				const float* in = rgb + i * 3;
 
-			default:
-				c.append(outColors[i].getFloatRed());
-				c.append(outColors[i].getFloatGreen());
-				c.append(outColors[i].getFloatBlue());
-				break;
+				if (cm == HS)
+				{
+					float h, s, b;
+					outColors[i].getHSB(h, s, b);
+					c[0] = h;
+					c[1] = s;
+				}
+				else if (cm == CMY)
+				{
+					c[0] = 1 - in[0];
+					c[1] = 1 - in[1];
+					c[2] = 1 - in[2];
+				}
+				else
+				{
+					c[0] = in[0];
+					c[1] = in[1];
+					c[2] = in[2];
+				}
 			}
+			break;
+		}
+
+		for (int i = 0; i < numPixels; i++)
+		{
+			const float* c = converted + i * 5;
 
 			int ch = targetChannel + i * finalColorSize;
 
@@ -268,7 +293,7 @@ void ColorComponent::fillInterfaceDataInternal(Interface* i, var data, var param
 				switch (fm)
 				{
 				case None:
-					channelsData[ch + ci] = roundToInt((float)c[indices[ci]] * 255);
+					channelsData[ch + ci] = roundToInt(c[indices[ci]] * 255);
 					break;
 
 				case Alternate:
@@ -279,7 +304,7 @@ void ColorComponent::fillInterfaceDataInternal(Interface* i, var data, var param
 
 					if (index2 >= channelsData.size()) break;
 
-					float val = (float)c[indices[ci]] * 255;
+					float val = c[indices[ci]] * 255;
 
 					channelsData[index1] = floor(val);
 					channelsData[index2] = fmodf(val, 1) * 255;
@@ -302,7 +327,7 @@ void ColorComponent::onContainerParameterChangedInternal(Parameter* p)
 
 	if (p == resolution)
 	{
-		if (pixelShape != nullptr) pixelShape->resolution = resolution->intValue();
+		if (pixelShape != nullptr) pixelShape->setResolution(resolution->intValue());
 		update();
 	}
 }
@@ -363,12 +388,12 @@ void ColorComponent::loadJSONDataItemInternal(var data)
 		colorSource->loadJSONData(csData);
 	}
 
-	if (data.hasProperty("pixelShape"))
+	var shapeData = data.getProperty("pixelShape", var());
+	if (shapeData.isObject())
 	{
-		setupShape(data.getProperty("pixelShape", var()).getProperty("type", ""));
+		setupShape(shapeData.getProperty("type", ""));
+		pixelShape->loadJSONData(shapeData);
 	}
-
-	if (pixelShape != nullptr) data.getDynamicObject()->setProperty("pixelShape", pixelShape->getJSONData());
 }
 
 InspectableEditor* ColorComponent::getEditorInternal(bool isRoot, Array<Inspectable*> inspectables)
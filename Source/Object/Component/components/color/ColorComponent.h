@@ -56,6 +56,9 @@ public:
 
 	DimmerComponent* dimmerComponent; //if useDimmerForOpacity is checked
 
+	Array<float> rgbBuffer; //r,g,b per pixel, reused across ticks for batched conversion
+	Array<float> convertedBuffer; //r,g,b,w,a per pixel
+
 
 	void setupSource(const String& type, ColorSource* templateRef = nullptr);
 	void setupShape(const String& type);
@@ -68,7 +68,7 @@ OrientationComponent::~OrientationComponent()
 
 }
 
-void OrientationComponent::setPanTiltFromTarget(Vec3 worldTarget)
+void OrientationComponent::setPanTiltFromTarget(Vec3 worldTarget, HashMap<Parameter*, var>& values)
 {
 	Vec3 position = Vec3::Up() * headOffset->floatValue();// InverseTransformPoint(transform.position, transform.rotation, transform.localScale, tiltT.position);
 
@@ -87,8 +87,7 @@ void OrientationComponent::setPanTiltFromTarget(Vec3 worldTarget)
 	}
 
 
-	Vec3 computedTarget = ((Point3DParameter*)paramComputedMap[target])->getVector();
-	Vec3 localTarget = inverseTransformPoint(object->stagePosition->getVector(), rot, Vector3D<float>(1, 1, 1), computedTarget);
+	Vec3 localTarget = inverseTransformPoint(object->stagePosition->getVector(), rot, Vector3D<float>(1, 1, 1), worldTarget);
 
 	//debugPos->setVector(localTarget.X, localTarget.Y, localTarget.Z);
 
@@ -129,8 +128,9 @@ void OrientationComponent::setPanTiltFromTarget(Vec3 worldTarget)
 	}
 
 
-	pan->setValue(targetPan + paramComputedMap[panOffset]->floatValue());
-	tilt->setValue(targetTilt + paramComputedMap[tiltOffset]->floatValue());
+	//offsets come from the values being computed, the computed parameters are only published on the message thread
+	values.set(paramComputedMap[pan], targetPan + (float)values[paramComputedMap[panOffset]]);
+	values.set(paramComputedMap[tilt], targetTilt + (float)values[paramComputedMap[tiltOffset]]);
 
 }
 
@@ -172,17 +172,8 @@ void OrientationComponent::updateComputedValues(HashMap<Parameter*, var>& values
 		ControlMode cm = controlMode->getValueDataAsEnum<ControlMode>();
 		if (cm == TARGET)
 		{
-			target->setEnabled(cm == TARGET);
-
-			Parameter* targetC = paramComputedMap[target];
-			Parameter* panC = paramComputedMap[pan];
-			Parameter* tiltC = paramComputedMap[tilt];
-
-			var tVal = values[targetC];
-			setPanTiltFromTarget(Vec3(tVal[0], tVal[1], tVal[1]));
-
-			values.set(panC, pan->getValue());
-			values.set(tiltC, tilt->getValue());
+			var tVal = values[paramComputedMap[target]];
+			setPanTiltFromTarget(Vec3(tVal[0], tVal[1], tVal[2]), values);
 		}
 	}
 
@@ -234,8 +225,8 @@ var OrientationComponent::getMappedValueForComputedParam(Interface* i, Parameter
 		Point2DParameter* panR = useAlt ? dmxPanValueRange2 : dmxPanValueRange;
 		Point2DParameter* tiltR = useAlt ? dmxTiltValueRange2 : dmxTiltValueRange;
 
-		if (cp == paramComputedMap[pan]) return jmap<float>(cp->floatValue(), panR->x, panR->y);
-		else if (cp == paramComputedMap[tilt]) return jmap<float>(cp->floatValue(), tiltR->x, tiltR->y);
+		if (cp == paramComputedMap[pan]) return jmap<float>(getComputedValue(cp), panR->x, panR->y);
+		else if (cp == paramComputedMap[tilt]) return jmap<float>(getComputedValue(cp), tiltR->x, tiltR->y);
 	}
 
 	return ObjectComponent::getMappedValueForComputedParam(i, cp);
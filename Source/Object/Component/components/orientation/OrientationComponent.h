@@ -55,7 +55,7 @@ public:
 	Point3DParameter* debugPos;
 
 
-	void setPanTiltFromTarget(Vec3 worldTarget);
+	void setPanTiltFromTarget(Vec3 worldTarget, HashMap<Parameter*, var>& values);
 	Vec3 inverseTransformPoint(Vec3 localPos, Vec3 localRot, Vec3 localScale, Vec3 targetPos);
 
 	void onContainerParameterChangedInternal(Parameter*) override;
@@ -0,0 +1,167 @@
+/*
+  ==============================================================================
+
+    EffectChain.cpp
+    Created: 18 Oct 2026 9:02:17pm
+    Author:  bkupe
+
+  ==============================================================================
+*/
+
+EffectChain::EffectChain(Object* o, ObjectComponent* c) :
+	object(o),
+	component(c),
+	generation(0),
+	scene(nullptr),
+	sceneStart(0),
+	sceneEnd(0)
+{
+}
+
+bool EffectChain::needsRebuild(uint32 currentGeneration) const
+{
+	if (scene != nullptr && sceneRef.wasObjectDeleted()) return true;
+	return generation != currentGeneration || scene != SceneManager::getInstance()->currentScene;
+}
+
+void EffectChain::build(uint32 currentGeneration)
+{
+	generation = currentGeneration;
+	steps.clearQuick();
+
+	//local effects
+	addEffectSteps(object->effectManager.get());
+
+	//scene sequences and effects
+	scene = SceneManager::getInstance()->currentScene;
+	sceneRef = scene;
+	sceneStart = steps.size();
+	if (scene != nullptr)
+	{
+		for (auto& s : scene->sequenceManager->items) addSequenceStep((BluxSequence*)s);
+		addEffectSteps(scene->effectManager.get());
+	}
+	sceneEnd = steps.size();
+
+	//group effects
+	for (auto& g : GroupManager::getInstance()->items)
+	{
+		if (g->enabled->boolValue() && g->containsObject(object)) addEffectSteps(g->effectManager.get(), g->getLocalIDForObject(object));
+	}
+
+	//global sequences and effects
+	for (auto& s : GlobalSequenceManager::getInstance()->items) addSequenceStep((BluxSequence*)s);
+	for (auto& eg : GlobalEffectManager::getInstance()->items)
+	{
+		if (eg->enabled->boolValue()) addEffectSteps(&eg->effectManager);
+	}
+}
+
+void EffectChain::addEffectSteps(EffectManager* em, int id)
+{
+	for (auto& e : em->items)
+	{
+		if (!e->enabled->boolValue() || !e->isAffectingObjectAndComponent(object, component->componentType)) continue;
+
+		FilterResult r = e->filterManager->getFilteredResultForComponent(object, component);
+		if (r.id == -1) continue;
+
+		Step s;
+		s.itemRef = e;
+		s.managerWeightRef = em->globalWeight;
+		s.effect = e;
+		s.managerWeight = em->globalWeight;
+		s.filterWeight = r.weight;
+		s.targetID = e->getTargetID(object, r.id, id);
+		steps.add(s);
+	}
+}
+
+void EffectChain::addSequenceStep(BluxSequence* s)
+{
+	if (!s->enabled->boolValue() || !s->isAffectingObject(object)) return;
+
+	Step step;
+	step.itemRef = s;
+	step.sequence = s;
+	steps.add(step);
+}
+
+void EffectChain::process(HashMap<Parameter*, var>& values)
+{
+	processSteps(0, sceneStart, values);
+
+	SceneManager* sm = SceneManager::getInstance();
+	const bool sceneTransition = scene != nullptr && !sceneRef.wasObjectDeleted() && sm->previousScene != nullptr && !scene->isCurrent->boolValue() && scene->loadProgress->floatValue() < 1;
+	if (sceneTransition) sm->processComponent(object, component, values);
+	else processSteps(sceneStart, sceneEnd, values);
+
+	processSteps(sceneEnd, steps.size(), values);
+}
+
+void EffectChain::processSteps(int start, int end, HashMap<Parameter*, var>& values)
+{
+	for (int i = start; i < end; i++)
+	{
+		const Step& s = steps.getReference(i);
+		if (!isStepAlive(s)) continue;
+
+		if (s.sequence != nullptr) s.sequence->processComponent(object, component, values);
+		else s.effect->processResolvedComponent(object, component, values, s.filterWeight * s.managerWeight->floatValue(), s.targetID);
+	}
+}
+
+bool EffectChain::isStepAlive(const Step& s)
+{
+	if (s.itemRef.wasObjectDeleted()) return false;
+	return s.sequence != nullptr || !s.managerWeightRef.wasObjectDeleted();
+}
+
+
+EffectChainWatcher::EffectChainWatcher(BluxEngine* engine) :
+	engine(engine)
+{
+	engine->addControllableContainerListener(this);
+}
+
+EffectChainWatcher::~EffectChainWatcher()
+{
+	engine->removeControllableContainerListener(this);
+}
+
+bool EffectChainWatcher::changesChains(Controllable* c)
+{
+	if (c->isControllableFeedbackOnly) return false;
+
+	ObjectManager* om = ObjectManager::getInstance();
+	for (ControllableContainer* cc = c->parentContainer.get(); cc != nullptr; cc = cc->parentContainer.get())
+	{
+		if (dynamic_cast<ObjectComponent*>(cc) != nullptr) return false; //component values are the input of the chain
+		if (dynamic_cast<FilterManager*>(cc) != nullptr) return true;
+		if (Effect* e = dynamic_cast<Effect*>(cc)) return c == e->enabled || c == e->idMode;
+		if (EffectManager* em = dynamic_cast<EffectManager*>(cc)) return c != em->globalWeight;
+		if (Sequence* s = dynamic_cast<Sequence*>(cc))
+		{
+			SequenceLayer* l = dynamic_cast<SequenceLayer*>(c->parentContainer.get());
+			return c == s->enabled || (l != nullptr && c == l->enabled);
+		}
+		if (Scene* s = dynamic_cast<Scene*>(cc))
+		{
+			if (c->parentContainer == s) return false; //scene changes are checked by the chains
+		}
+		if (cc == &om->customParams || dynamic_cast<ObjectManagerCustomParams*>(cc) != nullptr) return false;
+		if (cc == InterfaceManager::getInstance() || cc == StageLayoutManager::getInstance() || cc == ColorSourceLibrary::getInstance()) return false;
+	}
+
+	return true;
+}
+
+void EffectChainWatcher::controllableFeedbackUpdate(ControllableContainer* cc, Controllable* c)
+{
+	if (changesChains(c)) ObjectManager::getInstance()->invalidateEffectChains();
+}
+
+void EffectChainWatcher::childStructureChanged(ControllableContainer* cc)
+{
+	ObjectManager::getInstance()->invalidateEffectChains();
+}
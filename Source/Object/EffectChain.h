@@ -0,0 +1,80 @@
+/*
+  ==============================================================================
+
+    EffectChain.h
+    Created: 18 Oct 2026 9:02:17pm
+    Author:  bkupe
+
+  ==============================================================================
+*/
+
+#pragma once
+
+class Object;
+class ObjectComponent;
+class Effect;
+class EffectManager;
+class BluxSequence;
+class Scene;
+class BluxEngine;
+
+//Effects that process a component, in chain order (local, scene, groups, global sequences, global effects),
+//resolved once : disabled and filtered out effects are skipped, filter weights and IDs are precomputed.
+//Only the effect and manager weights are read at each tick, sequences are still processed live.
+//Chains are rebuilt when the ObjectManager chain generation changes, or when the current scene changes.
+//Steps keep weak references to what they point to : until the next rebuild, steps whose item was deleted are skipped.
+class EffectChain
+{
+public:
+    EffectChain(Object* o, ObjectComponent* c);
+    ~EffectChain() {}
+
+    struct Step
+    {
+        WeakReference<ControllableContainer> itemRef; //the effect or the sequence
+        WeakReference<Controllable> managerWeightRef;
+        Effect* effect = nullptr;
+        FloatParameter* managerWeight = nullptr;
+        float filterWeight = 1;
+        int targetID = -1;
+        BluxSequence* sequence = nullptr; //processed live instead of an effect
+    };
+
+    Object* object;
+    ObjectComponent* component;
+
+    uint32 generation;
+    WeakReference<ControllableContainer> sceneRef;
+    Scene* scene;
+
+    Array<Step> steps;
+    int sceneStart; //steps of the current scene, replaced by the scene manager blending during transitions
+    int sceneEnd;
+
+    bool needsRebuild(uint32 currentGeneration) const;
+    void build(uint32 currentGeneration);
+    void addEffectSteps(EffectManager* em, int id = -1);
+    void addSequenceStep(BluxSequence* s);
+
+    void process(HashMap<Parameter*, var>& values);
+    void processSteps(int start, int end, HashMap<Parameter*, var>& values);
+    static bool isStepAlive(const Step& s);
+};
+
+//Bumps the chain generation when an edit can change which effects process which components : items added or removed,
+//enable states, filters, groups, object IDs and positions. Effect parameters, weights, component values
+//and sequence playback are read at each tick and don't invalidate the chains.
+class EffectChainWatcher :
+    public ControllableContainerListener
+{
+public:
+    EffectChainWatcher(BluxEngine* engine);
+    ~EffectChainWatcher();
+
+    BluxEngine* engine;
+
+    static bool changesChains(Controllable* c);
+
+    void controllableFeedbackUpdate(ControllableContainer* cc, Controllable* c) override;
+    void childStructureChanged(ControllableContainer* cc) override;
+};
@@ -19,7 +19,8 @@ Object::Object(var params) :
 	objectType(params.getProperty("type", "Object").toString()),
 	objectData(params),
 	previousID(-1),
-	slideManipParameter(nullptr)
+	slideManipParameter(nullptr),
+	effectChainsGeneration(0)
 {
 	saveAndLoadRecursiveData = true;
 
@@ -33,55 +34,9 @@ Object::Object(var params) :
 
 	icon = addEnumParameter("Icon", "Bring some fancy in you life ! Put icons in the objects folders and find them here to customize you view");
 
-	if (objPath.exists())
+	if (ObjectLibrary::Entry::Ptr e = ObjectLibrary::getInstance()->getEntry(objPath))
 	{
-
-		File defaultON = objPath.getChildFile("icon_on.png");
-		File defaultOFF = objPath.getChildFile("icon_off.png");
-		File defaultImg = objPath.getChildFile("icon.png");
-
-		var defaultOpt;
-
-		if (defaultON.existsAsFile() && defaultOFF.existsAsFile())
-		{
-			defaultOpt.append(defaultOFF.getFullPathName());
-			defaultOpt.append(defaultON.getFullPathName());
-		}
-		else
-		{
-			defaultOpt = defaultImg.getFullPathName();
-		}
-
-		icon->addOption("Default", defaultOpt);
-
-		File staticFolder = objPath.getChildFile("icons/static");
-		if (staticFolder.isDirectory())
-		{
-			Array<File> files = staticFolder.findChildFiles(File::findFiles, false, "*.png");
-			for (auto& f : files)
-			{
-				icon->addOption(f.getFileNameWithoutExtension(), f.getFullPathName());
-			}
-		}
-
-		File variableFolder = objPath.getChildFile("icons/variable");
-		if (variableFolder.isDirectory())
-		{
-			Array<File> files = variableFolder.findChildFiles(File::findFiles, false, "*_on.png");
-			for (auto& f : files)
-			{
-				File offFile = variableFolder.getChildFile(f.getFileName().replace("_on", "_off"));
-				if (offFile.existsAsFile())
-				{
-					String base = f.getFileNameWithoutExtension();
-					String fName = base.substring(0, base.length() - 3);
-					var opt;
-					opt.append(offFile.getFullPathName());
-					opt.append(f.getFullPathName());
-					icon->addOption(fName, opt);
-				}
-			}
-		}
+		for (int i = 0; i < e->iconNames.size(); i++) icon->addOption(e->iconNames[i], e->iconValues[i]);
 	}
 
 	icon->addOption("Custom", -1);
@@ -261,26 +216,36 @@ void Object::computeComponentValues(ObjectComponent* c)
 	{
 		if (!ObjectManager::getInstance()->blackOut->boolValue())
 		{
+			//local, scene, group and global effects, resolved when the chain was built
+			getCompiledEffectChain(c)->process(values);
+		}
 
-			//local effects
-			effectManager->processComponent(this, c, values);
-
-			//scene effects
-			SceneManager::getInstance()->processComponent(this, c, values);
-
-			//group effects
-			GroupManager::getInstance()->processComponent(this, c, values); //to optimize with group registration on add/remove and not checking always at compute time
-
-			//global effects
-			GlobalSequenceManager::getInstance()->processComponent(this, c, values);
-			GlobalEffectManager::getInstance()->processComponent(this, c, values);
+		c->updateComputedValues(values);
+	}
 
+}
 
-		}
+EffectChain* Object::getCompiledEffectChain(ObjectComponent* c)
+{
+	const uint32 generation = ObjectManager::getInstance()->effectChainGeneration;
+	if (generation != effectChainsGeneration)
+	{
+		//components may have been removed since the chains were built
+		effectChainMap.clear();
+		effectChains.clear();
+		effectChainsGeneration = generation;
+	}
 
-		c->updateComputedValues(values);
+	EffectChain* chain = effectChainMap[c];
+	if (chain == nullptr)
+	{
+		chain = new EffectChain(this, c);
+		effectChains.add(chain);
+		effectChainMap.set(c, chain);
 	}
 
+	if (chain->needsRebuild(generation)) chain->build(generation);
+	return chain;
 }
 
 var Object::getSceneData()
@@ -328,6 +293,13 @@ void Object::componentsChanged()
 }
 
 void Object::afterLoadJSONDataInternal()
+{
+	//when loading a show, this is done for all objects at once after all interfaces and objects are loaded
+	if (Engine::mainEngine->isLoadingFile) return;
+	rebuildComponentsInterfaceParams();
+}
+
+void Object::rebuildComponentsInterfaceParams()
 {
 	if (Interface* i = (Interface*)targetInterface->targetContainer.get()) for (auto& c : componentManager->items) c->rebuildInterfaceParams(i);
 }
@@ -61,6 +61,7 @@ public:
 
 
 	void rebuildInterfaceParams();
+	void rebuildComponentsInterfaceParams();
 
 	template<class T>
 	T* getComponent();
@@ -69,8 +70,14 @@ public:
 	void onContainerParameterChangedInternal(Parameter* p) override;
 	void onControllableFeedbackUpdateInternal(ControllableContainer* cc, Controllable* c) override;
 
+	//compute thread only
+	OwnedArray<EffectChain> effectChains;
+	HashMap<ObjectComponent*, EffectChain*> effectChainMap;
+	uint32 effectChainsGeneration;
+
 	void checkAndComputeComponentValuesIfNeeded();
 	void computeComponentValues(ObjectComponent* c);
+	EffectChain* getCompiledEffectChain(ObjectComponent* c);
 
 	var getSceneData();
 	void updateSceneData(var& sceneData);
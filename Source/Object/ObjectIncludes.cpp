@@ -49,7 +49,9 @@
 #include "Layout/ui/StageLayoutManagerUI.cpp"
 #include "Layout/ui/StageLayoutUI.cpp"
 
+#include "ObjectLibrary.cpp"
 #include "Object.cpp"
+#include "EffectChain.cpp"
 #include "ObjectManager.cpp"
 #include "ui/ObjectChainVizUI.cpp"
 #include "ui/ObjectGridUI.cpp"
@@ -44,6 +44,8 @@
 #include "Group/ui/GroupManagerUI.h"
 
 
+#include "ObjectLibrary.h"
+#include "EffectChain.h"
 #include "Object.h"
 #include "ObjectManager.h"
 #include "ui/ObjectChainVizUI.h"
@@ -0,0 +1,245 @@
+/*
+  ==============================================================================
+
+	ObjectLibrary.cpp
+	Created: 18 Oct 2026 5:02:18pm
+	Author:  bkupe
+
+  ==============================================================================
+*/
+
+juce_ImplementSingleton(ObjectLibrary);
+
+ObjectLibrary::ObjectLibrary() :
+	cacheIsDirty(false)
+{
+	loadCache();
+}
+
+ObjectLibrary::~ObjectLibrary()
+{
+	if (cacheIsDirty) saveCache();
+}
+
+ObjectLibrary::Entry::Ptr ObjectLibrary::getEntry(const File& folder)
+{
+	if (!folder.isDirectory()) return nullptr;
+
+	const String key = folder.getFullPathName();
+	const uint32 now = Time::getMillisecondCounter();
+
+	Entry::Ptr e;
+	{
+		GenericScopedLock lock(libraryLock);
+		e = entries[key];
+		if (e != nullptr && now - e->lastValidationTime < (uint32)validationInterval) return e;
+	}
+
+	const int64 stamp = getFolderStamp(folder);
+	if (e != nullptr && e->stamp == stamp)
+	{
+		e->lastValidationTime = now;
+		return e;
+	}
+
+	//scanned outside the lock so several folders can be scanned at the same time
+	e = new Entry();
+	e->folder = folder;
+	e->stamp = stamp;
+	e->lastValidationTime = now;
+	scanFolder(e.get());
+
+	GenericScopedLock lock(libraryLock);
+	entries.set(key, e);
+	cacheIsDirty = true;
+	return e;
+}
+
+void ObjectLibrary::prefetch(const Array<File>& folders)
+{
+	if (folders.isEmpty()) return;
+
+	WaitableEvent allDone;
+	std::atomic<int> numRemaining(folders.size());
+
+	ThreadPool pool(jlimit(1, 8, SystemStats::getNumCpus()));
+	for (auto& f : folders)
+	{
+		pool.addJob([this, f, &allDone, &numRemaining]()
+			{
+				if (Entry::Ptr e = getEntry(f)) e->loadImages();
+				if (--numRemaining == 0) allDone.signal();
+			});
+	}
+
+	allDone.wait();
+}
+
+void ObjectLibrary::clear()
+{
+	GenericScopedLock lock(libraryLock);
+	entries.clear();
+	cacheIsDirty = true;
+}
+
+int64 ObjectLibrary::getFolderStamp(const File& folder)
+{
+	//directory times change when files are added or removed, so this catches new icons without listing them
+	int64 stamp = folder.getLastModificationTime().toMilliseconds();
+	const char* children[] = { "definition.json", "icons", "icons/static", "icons/variable" };
+	for (auto& c : children) stamp = stamp * 31 + folder.getChildFile(c).getLastModificationTime().toMilliseconds();
+	return stamp;
+}
+
+void ObjectLibrary::scanFolder(Entry* e)
+{
+	File defFile = e->folder.getChildFile("definition.json");
+	e->hasDefinitionFile = defFile.existsAsFile();
+	if (e->hasDefinitionFile)
+	{
+		var def = JSON::parse(defFile);
+		if (def.isObject() && def.hasProperty("name"))
+		{
+			def.getDynamicObject()->setProperty("path", e->folder.getFullPathName());
+			e->definition = def;
+		}
+	}
+
+	File defaultON = e->folder.getChildFile("icon_on.png");
+	File defaultOFF = e->folder.getChildFile("icon_off.png");
+	File defaultImg = e->folder.getChildFile("icon.png");
+
+	var defaultOpt;
+
+	if (defaultON.existsAsFile() && defaultOFF.existsAsFile())
+	{
+		defaultOpt.append(defaultOFF.getFullPathName());
+		defaultOpt.append(defaultON.getFullPathName());
+	}
+	else
+	{
+		defaultOpt = defaultImg.getFullPathName();
+	}
+
+	e->iconNames.add("Default");
+	e->iconValues.add(defaultOpt);
+
+	File staticFolder = e->folder.getChildFile("icons/static");
+	if (staticFolder.isDirectory())
+	{
+		Array<File> files = staticFolder.findChildFiles(File::findFiles, false, "*.png");
+		for (auto& f : files)
+		{
+			e->iconNames.add(f.getFileNameWithoutExtension());
+			e->iconValues.add(f.getFullPathName());
+		}
+	}
+
+	File variableFolder = e->folder.getChildFile("icons/variable");
+	if (variableFolder.isDirectory())
+	{
+		Array<File> files = variableFolder.findChildFiles(File::findFiles, false, "*_on.png");
+		for (auto& f : files)
+		{
+			File offFile = variableFolder.getChildFile(f.getFileName().replace("_on", "_off"));
+			if (offFile.existsAsFile())
+			{
+				String base = f.getFileNameWithoutExtension();
+				var opt;
+				opt.append(offFile.getFullPathName());
+				opt.append(f.getFullPathName());
+				e->iconNames.add(base.substring(0, base.length() - 3));
+				e->iconValues.add(opt);
+			}
+		}
+	}
+}
+
+File ObjectLibrary::getCacheFile() const
+{
+	return File::getSpecialLocation(File::userApplicationDataDirectory).getChildFile(String(ProjectInfo::projectName) + "/objectLibrary.cache");
+}
+
+void ObjectLibrary::loadCache()
+{
+	File f = getCacheFile();
+	if (!f.existsAsFile()) return;
+
+	FileInputStream is(f);
+	if (!is.openedOk()) return;
+	if (is.readString() != "BLXO" || is.readInt() != cacheVersion) return;
+
+	GenericScopedLock lock(libraryLock);
+
+	const int numEntries = is.readInt();
+	for (int i = 0; i < numEntries && !is.isExhausted(); i++)
+	{
+		Entry::Ptr e = new Entry();
+		e->folder = File(is.readString());
+		e->stamp = is.readInt64();
+		e->hasDefinitionFile = is.readBool();
+		e->definition = JSON::parse(is.readString());
+
+		const int numIcons = is.readInt();
+		for (int j = 0; j < numIcons && !is.isExhausted(); j++)
+		{
+			e->iconNames.add(is.readString());
+			e->iconValues.add(var::readFromStream(is));
+		}
+
+		entries.set(e->folder.getFullPathName(), e);
+	}
+}
+
+void ObjectLibrary::saveCache()
+{
+	File f = getCacheFile();
+	f.getParentDirectory().createDirectory();
+
+	TemporaryFile tmp(f);
+	{
+		FileOutputStream os(tmp.getFile());
+		if (!os.openedOk()) return;
+
+		GenericScopedLock lock(libraryLock);
+
+		os.writeString("BLXO");
+		os.writeInt(cacheVersion);
+		os.writeInt(entries.size());
+		for (HashMap<String, Entry::Ptr>::Iterator it(entries); it.next();)
+		{
+			Entry* e = it.getValue().get();
+			os.writeString(e->folder.getFullPathName());
+			os.writeInt64(e->stamp);
+			os.writeBool(e->hasDefinitionFile);
+			os.writeString(JSON::toString(e->definition, true)); //objects can't be written as binary vars
+
+			os.writeInt(e->iconNames.size());
+			for (int i = 0; i < e->iconNames.size(); i++)
+			{
+				os.writeString(e->iconNames[i]);
+				e->iconValues[i].writeToStream(os);
+			}
+		}
+	}
+
+	if (tmp.overwriteTargetFileWithTemporary()) cacheIsDirty = false;
+}
+
+Image ObjectLibrary::Entry::getThumbnail()
+{
+	if (thumbnail.isNull()) thumbnail = ImageCache::getFromFile(folder.getChildFile("icon.png"));
+	return thumbnail;
+}
+
+void ObjectLibrary::Entry::loadImages()
+{
+	getThumbnail();
+	if (!iconImages.isEmpty()) return;
+
+	for (auto& v : iconValues)
+	{
+		if (v.isArray()) for (int i = 0; i < v.size(); i++) iconImages.add(ImageCache::getFromFile(File(v[i].toString())));
+		else iconImages.add(ImageCache::getFromFile(File(v.toString())));
+	}
+}
@@ -0,0 +1,62 @@
+/*
+  ==============================================================================
+
+	ObjectLibrary.h
+	Created: 18 Oct 2026 5:02:18pm
+	Author:  bkupe
+
+  ==============================================================================
+*/
+
+#pragma once
+
+//Parsed object definitions and icon catalogs, indexed once per object folder and shared by all the objects using it.
+//Entries are validated against the modification times of the folder, so patching many objects of the same type only scans the disk once.
+//The index is persisted between sessions in a small binary cache file.
+class ObjectLibrary
+{
+public:
+	juce_DeclareSingleton(ObjectLibrary, true);
+
+	ObjectLibrary();
+	~ObjectLibrary();
+
+	class Entry :
+		public ReferenceCountedObject
+	{
+	public:
+		typedef ReferenceCountedObjectPtr<Entry> Ptr;
+
+		File folder;
+		int64 stamp = 0;
+		bool hasDefinitionFile = false;
+		var definition; //parsed definition.json with the "path" property added, void if not valid
+
+		StringArray iconNames;
+		Array<var> iconValues; //a single path for static icons, [off, on] paths for variable icons
+		uint32 lastValidationTime = 0;
+
+		Image thumbnail;
+		Array<Image> iconImages; //keeps the decoded icons in the image cache once prefetched
+		Image getThumbnail();
+		void loadImages();
+	};
+
+	static const int cacheVersion = 1;
+	static const int validationInterval = 2000; //ms during which an entry is used without checking the files again
+
+	CriticalSection libraryLock;
+	HashMap<String, Entry::Ptr> entries;
+	bool cacheIsDirty;
+
+	Entry::Ptr getEntry(const File& folder);
+	void prefetch(const Array<File>& folders); //scans the folders and decodes their icons on worker threads
+	void clear();
+
+	static int64 getFolderStamp(const File& folder);
+	void scanFolder(Entry* e);
+
+	File getCacheFile() const;
+	void loadCache();
+	void saveCache();
+};
@@ -16,7 +16,10 @@ juce_ImplementSingleton(ObjectManager);
 ObjectManager::ObjectManager() :
 	BaseManager("Objects"),
 	Thread("ObjectManager"),
-	customParams("Custom Parameters", false, false, true, true)
+	customParams("Custom Parameters", false, false, true, true),
+	computeTick(0),
+	offlineThreadID(nullptr),
+	effectChainGeneration(1)
 {
 	itemDataType = "Object";
 	selectItemWhenCreated = true;
@@ -47,12 +50,14 @@ ObjectManager::ObjectManager() :
 	}
 
 	startThread();
+	startTimerHz(30); //computed values feedback to listeners, decoupled from the compute rate
 	Engine::mainEngine->addEngineListener(this);
 }
 
 ObjectManager::~ObjectManager()
 {
 	Engine::mainEngine->removeEngineListener(this);
+	stopTimer();
 	stopThread(1000);
 }
 
@@ -96,7 +101,7 @@ void ObjectManager::downloadObjects()
 	}
 }
 
-void ObjectManager::updateFactoryDefinitions()
+void ObjectManager::updateFactoryDefinitions(bool forceRescan)
 {
 
 	factory.defs.clear();
@@ -107,33 +112,61 @@ void ObjectManager::updateFactoryDefinitions()
 	customParams.getDynamicObject()->setProperty("isCustom", true);
 	factory.defs.add(Factory<Object>::Definition::createDef("", "Custom", &Object::create, customParams)->addIcon(img));
 
+	if (forceRescan) ObjectLibrary::getInstance()->clear();
+
 	File objectsFolder = File::getSpecialLocation(File::userDocumentsDirectory).getChildFile(String(ProjectInfo::projectName) + "/objects");
 	Array<File> objectsList = objectsFolder.findChildFiles(File::findDirectories, false);
 
 	for (int i = objectsList.size() - 1; i >= 0; i--) //reverse loop because directory listing is inverted
 	{
 		File of = objectsList[i];
-		File defFile = of.getChildFile("definition.json");
-		if (!defFile.existsAsFile())
+		ObjectLibrary::Entry::Ptr e = ObjectLibrary::getInstance()->getEntry(of);
+		if (e == nullptr) continue;
+
+		if (!e->hasDefinitionFile)
 		{
 			LOGWARNING("Object " << of.getFileName() << " definition file not found");
 			continue;
 		}
 
-		var def = JSON::parse(defFile);
-		if (!def.isObject() || !def.hasProperty("name"))
+		var def = e->definition;
+		if (!def.isObject())
 		{
 			LOGWARNING("Object " << of.getFileName() << "definition file is not valid");
 			continue;
 		}
 
-		def.getDynamicObject()->setProperty("path", of.getFullPathName());
+		factory.defs.add(Factory<Object>::Definition::createDef(def.getProperty("menu", "").toString(), def.getProperty("name", "[noname]").toString(), &Object::create, def)->addIcon(e->getThumbnail()));
+	}
+
+	ObjectLibrary* library = ObjectLibrary::getInstance();
+	if (library->cacheIsDirty) library->saveCache();
+}
+
 
-		Image img = ImageCache::getFromFile(of.getChildFile("icon.png"));
-		factory.defs.add(Factory<Object>::Definition::createDef(def.getProperty("menu", "").toString(), def.getProperty("name", "[noname]").toString(), &Object::create, def)->addIcon(img));
+void ObjectManager::prefetchResources(var data)
+{
+	Array<var>* itemsData = data.getProperty("items", var()).getArray();
+	if (itemsData == nullptr) return;
+
+	HashMap<String, String> typePaths;
+	for (auto& d : factory.defs) typePaths.set(d->type, d->params.getProperty("path", "").toString());
+
+	Array<File> folders;
+	for (auto& itemData : *itemsData)
+	{
+		String path = typePaths[itemData.getProperty("type", "").toString()];
+		if (path.isNotEmpty()) folders.addIfNotAlreadyThere(File(path));
 	}
+
+	ObjectLibrary::getInstance()->prefetch(folders);
 }
 
+void ObjectManager::resolveInterfaceParams()
+{
+	GenericScopedLock lock(items.getLock());
+	for (auto& o : items) o->rebuildComponentsInterfaceParams();
+}
 
 void ObjectManager::addItemInternal(Object* o, var data)
 {
@@ -219,24 +252,56 @@ void ObjectManager::run()
 	{
 		long millisBefore = Time::getMillisecondCounter();
 
-		objectManagerListeners.call(&ObjectManagerListener::updateStart);
-		for (auto& i : InterfaceManager::getInstance()->items) i->prepareSendValues(); //interfaces should listen to updateStart and updateFinish
+		EngineClock* clock = EngineClock::getInstance();
+		clock->tick();
 
+		//in virtual mode, ticks are paced at the virtual rate so the output still plays in real time
+		const int rate = clock->isVirtual() ? clock->virtualRate.load() : updateRate->intValue();
+		clock->tickRate = rate;
+		computeFrame();
 
-		//Process raw data before objects data
-		GlobalSequenceManager::getInstance()->processRawData();
+		if (clock->isVirtual() && clock->virtualFreeRun)
+		{
+			Thread::yield();
+			continue;
+		}
 
-		items.getLock().enter();
-		for (auto& o : items)  o->checkAndComputeComponentValuesIfNeeded();
-		items.getLock().exit();
+		long millisAfter = Time::getMillisecondCounter();
+		long millisToSleep = jmax<long>(1, 1000.0 / rate - (millisAfter - millisBefore));
+		sleep((int)millisToSleep);
+	}
+}
 
+void ObjectManager::computeFrame(bool sendValues)
+{
+	computeTick++;
+	if (computeTick == 0) computeTick = 1; //0 is used as "never computed" by caches
 
-		objectManagerListeners.call(&ObjectManagerListener::updateFinish);
+	objectManagerListeners.call(&ObjectManagerListener::updateStart);
+	for (auto& i : InterfaceManager::getInstance()->items) i->prepareSendValues(); //interfaces should listen to updateStart and updateFinish
+
+
+	//Process raw data before objects data
+	GlobalSequenceManager::getInstance()->processRawData();
+
+	items.getLock().enter();
+	for (auto& o : items)  o->checkAndComputeComponentValuesIfNeeded();
+	items.getLock().exit();
+
+
+	objectManagerListeners.call(&ObjectManagerListener::updateFinish);
+	if (sendValues)
+	{
 		for (auto& i : InterfaceManager::getInstance()->items) i->finishSendValues(); //interfaces should listen to updateStart and updateFinish
+	}
+}
 
-		long millisAfter = Time::getMillisecondCounter();
-		long millisToSleep = jmax<long>(1, 1000.0 / updateRate->intValue() - (millisAfter - millisBefore));
-		sleep((int)millisToSleep);
+void ObjectManager::timerCallback()
+{
+	//items are only modified on the message thread, no need to lock against the compute thread here
+	for (auto& o : items)
+	{
+		for (auto& c : o->componentManager->items) c->publishComputedValues();
 	}
 }
 
@@ -286,6 +351,7 @@ void ObjectManager::loadJSONDataManagerInternal(var data)
 
 void ObjectManager::afterLoadJSONDataInternal()
 {
+	if (Engine::mainEngine->isLoadingFile) return; //started in endLoadFile, once the whole show is loaded
 	startThread();
 }
 
@@ -331,9 +397,14 @@ void ObjectManagerCustomParams::rebuildCustomParams()
 {
 	if (om == nullptr) return;
 
+	GenericScopedLock lock(paramsLock);
+
 	var oldData = getJSONData();
+
+	localParamMap.clear();
 	clear();
 
+	HashMap<Parameter*, Parameter*> newMap;
 	for (auto& gci : om->customParams.items)
 	{
 		if (gci->controllable->type == Controllable::TRIGGER) continue;
@@ -343,19 +414,25 @@ void ObjectManagerCustomParams::rebuildCustomParams()
 			p->canBeDisabledByUser = true;
 			p->setEnabled(false);
 			addParameter(p);
+			newMap.set((Parameter*)gci->controllable, p);
 		}
 	}
 
 	loadJSONData(oldData);
+	localParamMap.swapWith(newMap);
 }
 
 var ObjectManagerCustomParams::getParamValueFor(WeakReference<Parameter> p)
 {
-	return getParamValueForName(p->shortName);
+	GenericScopedLock lock(paramsLock);
+	if (Parameter* ap = getActiveParamFor(p)) return ap->getValue();
+	jassertfalse;
+	return var();
 }
 
 var ObjectManagerCustomParams::getParamValueForName(const String& name)
 {
+	GenericScopedLock lock(paramsLock);
 	if (Parameter* p = getActiveCustomParamForName(name)) return p->getValue();
 	jassertfalse;
 	return var();
@@ -384,6 +461,14 @@ var ObjectManagerCustomParams::getParamValues()
 
 Parameter* ObjectManagerCustomParams::getActiveParamFor(WeakReference<Parameter> p)
 {
+	if (p == nullptr || p.wasObjectDeleted()) return nullptr;
+
+	if (localParamMap.contains(p.get()))
+	{
+		Parameter* lp = localParamMap[p.get()];
+		return lp->enabled ? lp : p.get();
+	}
+
 	return getActiveCustomParamForName(p->shortName);
 }
 
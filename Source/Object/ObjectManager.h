@@ -25,6 +25,7 @@ class ObjectManager :
 	public BaseManager<Object>,
 	public Object::ObjectListener,
 	public Thread,
+	public Timer,
 	public URL::DownloadTask::Listener,
 	public GenericControllableManager::ManagerListener,
 	public EngineListener
@@ -56,13 +57,27 @@ public:
 	GenericControllableManager customParams;
 	SpatManager spatializer;
 
+	uint32 computeTick; //incremented at each run loop, used to invalidate per-tick caches
+	Thread::ThreadID offlineThreadID; //set while an offline render computes frames instead of the compute thread
+
+	Array<Thread::ThreadID, CriticalSection> renderAheadThreadIDs; //sequence threads computing frames ahead of the compute thread
+	std::atomic<uint32> effectChainGeneration; //compiled effect chains of the objects are rebuilt when it changes
+
+	void invalidateEffectChains() { effectChainGeneration++; }
+
+	bool isComputeThread() const { return Thread::getCurrentThreadId() == getThreadId() || (offlineThreadID != nullptr && Thread::getCurrentThreadId() == offlineThreadID); }
+	bool isRenderAheadThread() const { return renderAheadThreadIDs.contains(Thread::getCurrentThreadId()); }
+
 	virtual void itemAdded(GenericControllableItem*) override;
 	virtual void itemsAdded(Array<GenericControllableItem*>) override;
 	virtual void itemRemoved(GenericControllableItem*) override;
 	virtual void itemsRemoved(Array<GenericControllableItem*>) override;
 
 	void downloadObjects();
-	void updateFactoryDefinitions();
+	void updateFactoryDefinitions(bool forceRescan = false);
+
+	void prefetchResources(var data);
+	void resolveInterfaceParams();
 	void addItemInternal(Object* o, var data) override;
 	void addItemsInternal(Array<Object*> items, var data) override;
 	void removeItemInternal(Object* o) override;
@@ -83,6 +98,8 @@ public:
 
 
 	void run() override;
+	void computeFrame(bool sendValues = true);
+	void timerCallback() override;
 
 	virtual void progress(URL::DownloadTask* task, int64 downloaded, int64 total) override;
 	virtual void finished(URL::DownloadTask* task, bool success) override;
@@ -122,6 +139,11 @@ public:
 
 	ObjectManager* om;
 
+	//global custom param -> local override, rebuilt with the params to avoid name lookups on the compute thread.
+	//The lock is held while the params are rebuilt and while a resolved param is used, so it can't be removed under its caller.
+	HashMap<Parameter*, Parameter*> localParamMap;
+	CriticalSection paramsLock;
+
 	void customParamsChanged(ObjectManager*);
 	void rebuildCustomParams();
 
@@ -129,6 +151,14 @@ public:
 	var getParamValueForName(const String& name);
 	var getParamValues();
 
+	template<class Func>
+	void callWithActiveParamFor(WeakReference<Parameter> p, Func f)
+	{
+		GenericScopedLock lock(paramsLock);
+		if (Parameter* ap = getActiveParamFor(p)) f(ap);
+	}
+
+	//the returned param is only valid while paramsLock is held, use callWithActiveParamFor otherwise
 	Parameter* getActiveParamFor(WeakReference<Parameter> p);
 	Parameter* getActiveCustomParamForName(const String& name);
 };
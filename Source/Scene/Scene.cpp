@@ -20,6 +20,7 @@ Scene::Scene(const String& name) :
 	saveAndLoadRecursiveData = true;
 
 	saveTrigger = addTrigger("Save", "Save the current state of things into this scene");
+	copyTrigger = addTrigger("Copy To Clipboard", "Copy the saved data of this scene to the clipboard, as JSON");
 	loadTrigger = addTrigger("Load", "Load this scene. This will change all parameters to what has been saved in this scene");
 	directLoadTrigger = addTrigger("Direct Load", "Directly load this scene. This will load without any timing");
 	defaultLoadTime = addFloatParameter("Load Time", "Default load time, used when using the \"Load\" trigger.", BluxSettings::getInstance()->defaultSceneLoadTime->floatValue(), 0);
@@ -32,8 +33,6 @@ Scene::Scene(const String& name) :
 	isCurrent->setControllableFeedbackOnly(true);
 	isCurrent->isSavable = false;
 
-	saveScene(); //is this good ?
-
 	interpolationCurve.isSelectable = false;
 	interpolationCurve.length->setValue(1);
 	interpolationCurve.addKey(0, 0, false);
@@ -62,11 +61,17 @@ Scene::~Scene()
 
 void Scene::saveScene()
 {
-	sceneData = getSceneData();
-	SystemClipboard::copyTextToClipboard(JSON::toString(sceneData));
+	sceneData = SceneDataStore::getInstance()->intern(getSceneData());
+	SceneDataStore::getInstance()->purge();
 	NLOG(niceName, "Scene saved");
 }
 
+void Scene::copySceneToClipboard()
+{
+	SystemClipboard::copyTextToClipboard(JSON::toString(sceneData));
+	NLOG(niceName, "Scene data copied to clipboard");
+}
+
 var Scene::getSceneData()
 {
 	var result = var(new DynamicObject());
@@ -116,6 +121,7 @@ void Scene::onContainerTriggerTriggered(Trigger* t)
 	BaseItem::onContainerTriggerTriggered(t);
 
 	if (t == saveTrigger) saveScene();
+	else if (t == copyTrigger) copySceneToClipboard();
 	else if (t == loadTrigger) loadScene();
 	else if (t == directLoadTrigger) loadScene(0);
 }
@@ -173,5 +179,5 @@ var Scene::getJSONData()
 
 void Scene::loadJSONDataItemInternal(var data)
 {
-	sceneData = data.getDynamicObject()->getProperty("sceneData");
+	sceneData = SceneDataStore::getInstance()->intern(data.getDynamicObject()->getProperty("sceneData"));
 }
@@ -22,6 +22,7 @@ public:
     var sceneData;
     
     Trigger* saveTrigger;
+    Trigger* copyTrigger;
     Trigger* loadTrigger;
     Trigger* directLoadTrigger;
     FloatParameter* defaultLoadTime;
@@ -37,6 +38,7 @@ public:
     ActionManager unloadActions;
 
     void saveScene();
+    void copySceneToClipboard();
     var getSceneData();
     void updateSceneData(); //used to resync with current objects and data that might not have been saved
     void loadScene(float loadTime = -1);
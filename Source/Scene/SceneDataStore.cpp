@@ -0,0 +1,101 @@
+/*
+  ==============================================================================
+
+	SceneDataStore.cpp
+	Created: 18 Oct 2026 4:12:40pm
+	Author:  bkupe
+
+  ==============================================================================
+*/
+
+juce_ImplementSingleton(SceneDataStore);
+
+var SceneDataStore::intern(var data)
+{
+	GenericScopedLock lock(storeLock);
+	int64 hash = 0;
+	return internInternal(data, hash);
+}
+
+void SceneDataStore::purge()
+{
+	GenericScopedLock lock(storeLock);
+
+	Array<int64> unused;
+	for (HashMap<int64, var>::Iterator it(objects); it.next();)
+	{
+		if (it.getValue().getDynamicObject()->getReferenceCount() <= 1) unused.add(it.getKey());
+	}
+
+	for (auto& h : unused) objects.remove(h);
+}
+
+var SceneDataStore::internInternal(var data, int64& hash)
+{
+	if (DynamicObject* d = data.getDynamicObject())
+	{
+		//children first, so equal children are already the same object and can be compared by pointer
+		var result(new DynamicObject());
+		DynamicObject* rd = result.getDynamicObject();
+
+		int64 contentHash = 17;
+		NamedValueSet& props = d->getProperties();
+		for (int i = 0; i < props.size(); i++)
+		{
+			int64 childHash = 0;
+			var child = internInternal(props.getValueAt(i), childHash);
+			rd->setProperty(props.getName(i), child);
+			contentHash = contentHash * 31 + props.getName(i).toString().hashCode64();
+			contentHash = contentHash * 31 + childHash;
+		}
+
+		if (objects.contains(contentHash))
+		{
+			var existing = objects[contentHash];
+			if (isSameObject(existing.getDynamicObject(), rd)) result = existing;
+		}
+		else
+		{
+			objects.set(contentHash, result);
+		}
+
+		hash = (int64)(pointer_sized_int)result.getDynamicObject();
+		return result;
+	}
+
+	if (data.isArray())
+	{
+		hash = 17;
+		for (int i = 0; i < data.size(); i++) hash = hash * 31 + data[i].toString().hashCode64();
+		return data;
+	}
+
+	hash = data.toString().hashCode64();
+	return data;
+}
+
+bool SceneDataStore::isSameObject(DynamicObject* a, DynamicObject* b)
+{
+	NamedValueSet& pa = a->getProperties();
+	NamedValueSet& pb = b->getProperties();
+	if (pa.size() != pb.size()) return false;
+
+	for (int i = 0; i < pa.size(); i++)
+	{
+		if (pa.getName(i) != pb.getName(i)) return false;
+
+		const var& va = pa.getValueAt(i);
+		const var& vb = pb.getValueAt(i);
+
+		if (va.isObject() || vb.isObject())
+		{
+			if (va.getObject() != vb.getObject()) return false;
+		}
+		else if (!va.equalsWithSameType(vb))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,34 @@
+/*
+  ==============================================================================
+
+    SceneDataStore.h
+    Created: 18 Oct 2026 4:12:40pm
+    Author:  bkupe
+
+  ==============================================================================
+*/
+
+#pragma once
+
+//Shares identical parts of scene data between scenes.
+//Scenes usually differ by a few parameters, so most of the objects, components and effects of a saved scene
+//are equal to the ones of another scene and are stored only once.
+//Scene data is never modified after being interned, it's only read when loading or previewing scenes.
+class SceneDataStore
+{
+public:
+    juce_DeclareSingleton(SceneDataStore, true);
+
+    SceneDataStore() {}
+    ~SceneDataStore() {}
+
+    CriticalSection storeLock;
+    HashMap<int64, var> objects; //content hash > shared object
+
+    var intern(var data);
+    void purge(); //removes the objects that are not used by any scene anymore
+
+private:
+    var internInternal(var data, int64& hash);
+    static bool isSameObject(DynamicObject* a, DynamicObject* b);
+};
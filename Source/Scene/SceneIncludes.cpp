@@ -15,6 +15,7 @@
 #include "Effect/GlobalEffectManager.h"
 #include "Effect/effects/time/TimedEffect.h"
 
+#include "SceneDataStore.cpp"
 #include "Scene.cpp"
 #include "SceneManager.cpp"
 
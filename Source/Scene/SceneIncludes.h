@@ -16,6 +16,7 @@
 #include "Sequence/SequenceIncludes.h"
 #include "Effect/EffectIncludes.h"
 
+#include "SceneDataStore.h"
 #include "Scene.h"
 #include "SceneManager.h"
 
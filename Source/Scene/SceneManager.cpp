@@ -17,6 +17,9 @@ SceneManager::SceneManager() :
 	Thread("Scene Load"),
 	previousScene(nullptr),
 	currentScene(nullptr),
+	steppedTransitions(false),
+	transitionRunning(false),
+	transitionStartTime(0),
 	sceneManagerNotifier(5)
 {
 	managerFactory = &factory;
@@ -44,11 +47,13 @@ SceneManager::SceneManager() :
 	lockUI = addBoolParameter("Lock UI", "If checked, all UI will be locked", false);
 
 	OSCRemoteControl::getInstance()->addRemoteControlListener(this);
+	EngineClock::getInstance()->addClockListener(this);
 }
 
 SceneManager::~SceneManager()
 {
 	stopThread(1000);
+	if (EngineClock::getInstanceWithoutCreating() != nullptr) EngineClock::getInstance()->removeClockListener(this);
 	if (OSCRemoteControl::getInstanceWithoutCreating() != nullptr) OSCRemoteControl::getInstance()->removeRemoteControlListener(this);
 
 }
@@ -58,11 +63,15 @@ void SceneManager::addItemInternal(Scene* s, var data)
 {
 	s->addSceneListener(this);
 	s->effectManager->setForceDisabled(true);
+
+	//scenes created by the user start with the current state, loaded and duplicated scenes come with their own data
+	if (data.isVoid() && !Engine::mainEngine->isLoadingFile) s->saveScene();
 }
 
 void SceneManager::removeItemInternal(Scene* s)
 {
 	s->removeSceneListener(this);
+	if (SceneDataStore* store = SceneDataStore::getInstanceWithoutCreating()) store->purge();
 }
 
 void SceneManager::loadScene(Scene* s, float time, bool setUndoIfNeeded)
@@ -70,6 +79,11 @@ void SceneManager::loadScene(Scene* s, float time, bool setUndoIfNeeded)
 	if (s == nullptr) return;
 
 	stopThread(1000);
+	if (isStepped() && transitionRunning)
+	{
+		GenericScopedLock lock(transitionLock);
+		endTransition();
+	}
 
 	if (forceLoadTime->enabled) time = forceLoadTime->floatValue();
 
@@ -102,6 +116,15 @@ void SceneManager::loadScene(Scene* s, float time, bool setUndoIfNeeded)
 
 	loadTime = time >= 0 ? time : currentScene->defaultLoadTime->floatValue();
 
+	if (isStepped())
+	{
+		//the transition is advanced at each clock tick, see clockTicked
+		GenericScopedLock lock(transitionLock);
+		startTransition(EngineClock::getInstance()->tickTime);
+		if (!transitionRunning) endTransition();
+		return;
+	}
+
 	startThread();
 }
 
@@ -119,10 +142,21 @@ Scene* SceneManager::getPreviousScene()
 
 void SceneManager::run()
 {
-	String oName = ObjectManager::getInstance()->shortName;
-	String gName = GroupManager::getInstance()->shortName;
-	String eName = GlobalEffectManager::getInstance()->shortName;
+	startTransition(EngineClock::getInstance()->tickTime);
 
+	while (!threadShouldExit() && transitionRunning)
+	{
+		if (Engine::mainEngine->isClearing) return;
+		updateTransition(EngineClock::getInstance()->tickTime);
+		if (transitionRunning) sleep(30);
+	}
+
+	if (Engine::mainEngine->isClearing) return;
+	endTransition();
+}
+
+void SceneManager::startTransition(double time)
+{
 	currentScene->loadProgress->setValue(0);
 	currentScene->effectManager->setForceDisabled(false);
 	currentScene->resetEffectTimes();
@@ -137,37 +171,48 @@ void SceneManager::run()
 
 	sceneManagerNotifier.addMessage(new SceneManagerEvent(SceneManagerEvent::SCENE_LOAD_START));
 
+	transitionData = currentScene->getSceneData().clone();
+	transitionStartTime = time;
+	transitionRunning = loadTime > 0;
+}
 
-	var dataAtLoad = currentScene->getSceneData().clone();
-	double timeAtLoad = Time::getMillisecondCounter() / 1000.0;
-	if (loadTime > 0)
-	{
-		while (!threadShouldExit() && currentScene->loadProgress->floatValue() < 1)
-		{
-			if (Engine::mainEngine->isClearing) return;
+void SceneManager::updateTransition(double time)
+{
+	if (!transitionRunning) return;
 
-			double curTime = Time::getMillisecondCounter() / 1000.0;
-			double progress = (curTime - timeAtLoad) / loadTime;
-			currentScene->loadProgress->setValue(progress);
+	String oName = ObjectManager::getInstance()->shortName;
+	String gName = GroupManager::getInstance()->shortName;
+	String eName = GlobalEffectManager::getInstance()->shortName;
 
-			float weight = currentScene->interpolationCurve.getValueAtPosition(progress);
+	double progress = (time - transitionStartTime) / loadTime;
+	currentScene->loadProgress->setValue(progress);
 
-			ObjectManager::getInstance()->lerpFromSceneData(dataAtLoad.getProperty(oName, var()), currentScene->sceneData.getProperty(oName, var()), weight);
-			GroupManager::getInstance()->lerpFromSceneData(dataAtLoad.getProperty(gName, var()), currentScene->sceneData.getProperty(gName, var()), weight);
-			GlobalEffectManager::getInstance()->lerpFromSceneData(dataAtLoad.getProperty(eName, var()), currentScene->sceneData.getProperty(eName, var()), weight);
+	float weight = currentScene->interpolationCurve.getValueAtPosition(progress);
 
-			sleep(30);
-		}
+	ObjectManager::getInstance()->lerpFromSceneData(transitionData.getProperty(oName, var()), currentScene->sceneData.getProperty(oName, var()), weight);
+	GroupManager::getInstance()->lerpFromSceneData(transitionData.getProperty(gName, var()), currentScene->sceneData.getProperty(gName, var()), weight);
+	GlobalEffectManager::getInstance()->lerpFromSceneData(transitionData.getProperty(eName, var()), currentScene->sceneData.getProperty(eName, var()), weight);
+
+	if (currentScene->loadProgress->floatValue() >= 1)
+	{
+		transitionRunning = false;
+		if (isStepped()) endTransition();
 	}
+}
 
-	if (Engine::mainEngine->isClearing) return;
+void SceneManager::endTransition()
+{
+	String oName = ObjectManager::getInstance()->shortName;
+	String gName = GroupManager::getInstance()->shortName;
+	String eName = GlobalEffectManager::getInstance()->shortName;
 
+	transitionRunning = false;
 
 	if (currentScene->loadProgress->floatValue() == 1 || loadTime == 0)
 	{
-		ObjectManager::getInstance()->lerpFromSceneData(dataAtLoad.getProperty(oName, var()), currentScene->sceneData.getProperty(oName, var()), 1);
-		GroupManager::getInstance()->lerpFromSceneData(dataAtLoad.getProperty(gName, var()), currentScene->sceneData.getProperty(gName, var()), 1);
-		GlobalEffectManager::getInstance()->lerpFromSceneData(dataAtLoad.getProperty(eName, var()), currentScene->sceneData.getProperty(eName, var()), 1);
+		ObjectManager::getInstance()->lerpFromSceneData(transitionData.getProperty(oName, var()), currentScene->sceneData.getProperty(oName, var()), 1);
+		GroupManager::getInstance()->lerpFromSceneData(transitionData.getProperty(gName, var()), currentScene->sceneData.getProperty(gName, var()), 1);
+		GlobalEffectManager::getInstance()->lerpFromSceneData(transitionData.getProperty(eName, var()), currentScene->sceneData.getProperty(eName, var()), 1);
 		currentScene->isCurrent->setValue(true);
 	}
 
@@ -183,9 +228,24 @@ void SceneManager::run()
 		previousScene->effectManager->setForceDisabled(true);
 	}
 
+	transitionData = var();
+
 	sceneManagerNotifier.addMessage(new SceneManagerEvent(SceneManagerEvent::SCENE_LOAD_END));
 }
 
+bool SceneManager::isStepped() const
+{
+	return steppedTransitions || EngineClock::getInstance()->isVirtual();
+}
+
+void SceneManager::clockTicked()
+{
+	if (!transitionRunning || !isStepped()) return;
+
+	GenericScopedLock lock(transitionLock);
+	updateTransition(EngineClock::getInstance()->tickTime);
+}
+
 void SceneManager::askForLoadScene(Scene* s, float loadTime)
 {
 	loadScene(s, loadTime);
@@ -18,6 +18,7 @@ class SceneManager :
 	public Inspectable::InspectableListener,
 	public SceneListener,
 	public OSCRemoteControl::RemoteControlListener,
+	public EngineClock::ClockListener,
 	public Thread
 {
 public:
@@ -59,7 +60,21 @@ public:
 	Scene* getNextScene();
 	Scene* getPreviousScene();
 
+	//Transitions run on the scene load thread in real time, or are stepped at each clock tick
+	//when the clock is virtual or driven from outside (offline rendering)
+	bool steppedTransitions;
+	bool transitionRunning;
+	double transitionStartTime;
+	var transitionData;
+	CriticalSection transitionLock;
+
+	bool isStepped() const;
+	void clockTicked() override;
+
 	void run() override;
+	void startTransition(double time);
+	void updateTransition(double time);
+	void endTransition();
 	//void lerpSceneParams(float weight);
 
 	void askForLoadScene(Scene* s, float time) override;
@@ -13,8 +13,18 @@
 #include "BluxSequence.h"
 
 BluxSequence::BluxSequence() :
-	manualStartAtLoad(false)
+	manualStartAtLoad(false),
+	bakePool(new BakedAutomationPool())
 {
+	bakeAutomations = addBoolParameter("Bake Automations", "If checked, effect automations are sampled in tables for faster playback. Exact values are still used while editing. Sampling smooths key steps and hard stops over one sample", false);
+	bakeResolution = addIntParameter("Bake Resolution", "Number of samples per second used when baking automations", 200, 10, 2000);
+	bakeMemoryBudget = addIntParameter("Bake Memory Budget", "Maximum memory in KB used by baked automations in this sequence, automations over the budget are evaluated directly", 4096, 0);
+	bakePool->setup(bakeAutomations->boolValue(), bakeResolution->intValue(), (int64)bakeMemoryBudget->intValue() * 1024);
+
+	renderAhead = addBoolParameter("Render Ahead", "If checked, while playing, the output of this sequence is computed a few frames ahead on its own thread, so heavy timelines play without late frames. Only used when all effects only depend on the time (no smoothing, freeze, live links or expressions)", false);
+	renderAheadFrames = addIntParameter("Render Ahead Frames", "Number of frames computed ahead", 4, 2, 32, false);
+	renderAheadBuffer.reset(new SequenceRenderAhead(this));
+
 	layerManager->factory.defs.add(SequenceLayerManager::LayerDefinition::createDef("", "Effect", &EffectLayer::create, this));
 	//layerManager->factory.defs.add(SequenceLayerManager::LayerDefinition::createDef("", "Automation", &AutomationLayer::create, this));
 	//layerManager->factory.defs.add(SequenceLayerManager::LayerDefinition::createDef("", "Color Source", &ColorSourceLayer::create, this));
@@ -29,6 +39,7 @@ BluxSequence::BluxSequence() :
 
 BluxSequence::~BluxSequence()
 {
+	renderAheadBuffer.reset();
 	layerManager->removeBaseManagerListener(this);
 }
 
@@ -60,17 +71,81 @@ Array<ChainVizTarget*> BluxSequence::getChainVizTargetsForObjectAndComponent(Obj
 }
 
 void BluxSequence::processComponent(Object* o, ObjectComponent* c, HashMap<Parameter*, var>& values, float weightMultiplier)
+{
+	if (renderAhead->boolValue() && isPlaying->boolValue())
+	{
+		renderAheadBuffer->processComponent(o, c, values, weightMultiplier);
+		return;
+	}
+
+	processComponentAtTime(o, c, values, weightMultiplier, currentTime->floatValue());
+}
+
+void BluxSequence::processComponentAtTime(Object* o, ObjectComponent* c, HashMap<Parameter*, var>& values, float weightMultiplier, float time)
 {
 	for (int i = layerManager->items.size() - 1; i >= 0; --i)
 	{
 		if (!layerManager->items[i]->enabled->boolValue()) continue;
 		if (EffectLayer* e = dynamic_cast<EffectLayer*>(layerManager->items[i]))
 		{
-			e->processComponent(o, c, values, weightMultiplier);
+			e->processComponent(o, c, values, weightMultiplier, time);
 		}
 	}
 }
 
+bool BluxSequence::canRenderAhead()
+{
+	for (auto& l : layerManager->items)
+	{
+		if (!l->enabled->boolValue()) continue;
+		if (EffectLayer* e = dynamic_cast<EffectLayer*>(l))
+		{
+			for (auto& b : e->blockManager.items)
+			{
+				EffectBlock* eb = (EffectBlock*)b;
+				if (eb->effect != nullptr && !eb->effect->canRenderAhead()) return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+void BluxSequence::updateRenderAhead()
+{
+	renderAheadFrames->setEnabled(renderAhead->boolValue());
+
+	if (renderAhead->boolValue() && isPlaying->boolValue()) renderAheadBuffer->start(renderAheadFrames->intValue());
+	else renderAheadBuffer->stop();
+}
+
+void BluxSequence::onContainerParameterChangedInternal(Parameter* p)
+{
+	Sequence::onContainerParameterChangedInternal(p);
+
+	if (p == bakeAutomations || p == bakeResolution || p == bakeMemoryBudget)
+	{
+		bakePool->setup(bakeAutomations->boolValue(), bakeResolution->intValue(), (int64)bakeMemoryBudget->intValue() * 1024);
+	}
+	else if (p == renderAhead || p == renderAheadFrames || p == isPlaying)
+	{
+		//isPlaying can change on the compute thread (mappings, actions). Stopping the render-ahead thread from there
+		//would wait for a thread that may itself be waiting for the objects lock held by the compute thread
+		if (MessageManager::getInstance()->isThisTheMessageThread())
+		{
+			updateRenderAhead();
+			return;
+		}
+
+		WeakReference<ControllableContainer> sequenceRef(this);
+		MessageManager::callAsync([sequenceRef]()
+			{
+				if (sequenceRef.wasObjectDeleted()) return;
+				((BluxSequence*)sequenceRef.get())->updateRenderAhead();
+			});
+	}
+}
+
 void BluxSequence::processRawData()
 {
 	for (int i = layerManager->items.size() - 1; i >= 0; --i)
@@ -13,6 +13,7 @@
 class Object;
 class ObjectComponent;
 class Effect;
+class SequenceRenderAhead;
 
 class BluxSequence :
     public Sequence,
@@ -25,13 +26,27 @@ public:
 
     bool manualStartAtLoad;
 
+    BoolParameter* bakeAutomations;
+    IntParameter* bakeResolution;
+    IntParameter* bakeMemoryBudget;
+    BakedAutomationPool::Ptr bakePool;
+
+    BoolParameter* renderAhead;
+    IntParameter* renderAheadFrames;
+    std::unique_ptr<SequenceRenderAhead> renderAheadBuffer;
+
     bool isAffectingObject(Object* o);
     Array<ChainVizTarget *> getChainVizTargetsForObjectAndComponent(Object* o, ComponentType t);
 
     virtual void processComponent(Object* o, ObjectComponent* c, HashMap<Parameter*, var>& values, float weightMultiplier = 1.0f);
+    void processComponentAtTime(Object* o, ObjectComponent* c, HashMap<Parameter*, var>& values, float weightMultiplier, float time);
+    bool canRenderAhead();
+    void updateRenderAhead();
 
     virtual void processRawData();
 
+    void onContainerParameterChangedInternal(Parameter* p) override;
+
     virtual void itemAdded(SequenceLayer* layer) override;
     virtual void itemsAdded(Array<SequenceLayer*> layers) override;
 
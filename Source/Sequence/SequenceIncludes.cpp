@@ -11,12 +11,14 @@
 #include "SequenceIncludes.h"
 #include "Object/ObjectIncludes.h"
 #include "Effect/EffectIncludes.h"
+#include "Scene/SceneIncludes.h"
 #include "MainIncludes.h"
 
 
 #include "actions/SequenceAction.cpp"
 
 #include "BluxSequence.cpp"
+#include "SequenceRenderAhead.cpp"
 #include "BluxSequenceManager.cpp"
 
 #include "GlobalSequenceManager.cpp"
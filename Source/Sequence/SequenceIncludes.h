@@ -17,6 +17,7 @@
 #include "Effect/EffectIncludes.h"
 #include "Interface/InterfaceIncludes.h"
 
+#include "SequenceRenderAhead.h"
 #include "BluxSequence.h"
 #include "BluxSequenceManager.h"
 #include "GlobalSequenceManager.h"
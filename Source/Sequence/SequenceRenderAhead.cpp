@@ -0,0 +1,291 @@
+/*
+  ==============================================================================
+
+    SequenceRenderAhead.cpp
+    Created: 18 Oct 2026 8:12:40pm
+    Author:  bkupe
+
+  ==============================================================================
+*/
+
+SequenceRenderAhead::SequenceRenderAhead(BluxSequence* sequence) :
+	Thread("Render Ahead " + sequence->niceName),
+	sequence(sequence),
+	generation(0),
+	fps(0),
+	numFrames(0),
+	checkedGeneration(0),
+	canRender(false)
+{
+	sequence->layerManager->addControllableContainerListener(this);
+	GroupManager::getInstance()->addControllableContainerListener(this); //group filters
+	SceneManager::getInstance()->addAsyncSceneManagerListener(this);
+}
+
+SequenceRenderAhead::~SequenceRenderAhead()
+{
+	stopThread(1000);
+
+	sequence->layerManager->removeControllableContainerListener(this);
+	if (GroupManager::getInstanceWithoutCreating() != nullptr) GroupManager::getInstance()->removeControllableContainerListener(this);
+	if (SceneManager::getInstanceWithoutCreating() != nullptr) SceneManager::getInstance()->removeAsyncSceneManagerListener(this);
+}
+
+void SequenceRenderAhead::start(int numFramesAhead)
+{
+	if (isThreadRunning() && numFramesAhead == numFrames) return;
+
+	stop();
+
+	{
+		GenericScopedLock lock(bufferLock);
+		numFrames = numFramesAhead;
+		for (int i = 0; i < numFrames; i++) frames.add(new Frame());
+	}
+
+	invalidate();
+	startThread();
+}
+
+void SequenceRenderAhead::stop()
+{
+	stopThread(1000);
+
+	GenericScopedLock lock(bufferLock);
+	frames.clear();
+	inputs.clear();
+	inputMap.clear();
+}
+
+void SequenceRenderAhead::invalidate()
+{
+	generation++;
+}
+
+int64 SequenceRenderAhead::getFrameIndex(float time) const
+{
+	return (int64)std::floor(time * fps + .5f);
+}
+
+void SequenceRenderAhead::processComponent(Object* o, ObjectComponent* c, HashMap<Parameter*, var>& values, float weightMultiplier)
+{
+	//frames follow the ticks of the engine clock, whatever drives it (real time, virtual or offline render)
+	const int rate = EngineClock::getInstance()->tickRate;
+	if (rate != fps)
+	{
+		fps = rate;
+		invalidate();
+	}
+
+	const float currentTime = sequence->currentTime->floatValue();
+	const int64 index = getFrameIndex(currentTime);
+
+	{
+		GenericScopedLock lock(bufferLock);
+		updateInput(o, c, values, weightMultiplier); //a new input version leaves the buffered outputs of this component stale
+		if (!frames.isEmpty() && index >= 0)
+		{
+			Frame* f = frames[(int)(index % frames.size())];
+			if (f->index == index && f->generation == generation && f->hasOutput(inputMap[c]))
+			{
+				HashMap<Parameter*, var>::Iterator it(*f->outputMap[c]);
+				while (it.next()) values.set(it.getKey(), it.getValue().clone()); //frames can be used by more than one tick
+				return;
+			}
+		}
+	}
+
+	//live and buffered frames are both computed on the frame grid, so switching between them doesn't jitter.
+	//When nothing can be buffered, the live output keeps the exact sequence time
+	const float time = canRender && rate > 0 ? index / (float)rate : currentTime;
+
+	GenericScopedLock lock(processLock);
+	sequence->processComponentAtTime(o, c, values, weightMultiplier, time);
+}
+
+bool SequenceRenderAhead::updateInput(Object* o, ObjectComponent* c, const HashMap<Parameter*, var>& values, float weightMultiplier)
+{
+	Input* in = inputMap.contains(c) ? inputMap[c] : nullptr;
+	if (in == nullptr)
+	{
+		in = new Input();
+		inputs.add(in);
+		inputMap.set(c, in);
+	}
+	else if (in->object == o && in->weightMultiplier == weightMultiplier && in->values.size() == values.size())
+	{
+		bool sameValues = true;
+		HashMap<Parameter*, var>::Iterator it(values);
+		while (it.next() && sameValues) sameValues = in->values.contains(it.getKey()) && in->values[it.getKey()] == it.getValue();
+		if (sameValues) return false;
+	}
+
+	in->objectRef = o;
+	in->componentRef = c;
+	in->object = o;
+	in->component = c;
+	in->weightMultiplier = weightMultiplier;
+	in->version++;
+	in->values.clear();
+	HashMap<Parameter*, var>::Iterator it(values);
+	while (it.next()) in->values.set(it.getKey(), it.getValue().clone());
+
+	return true;
+}
+
+void SequenceRenderAhead::run()
+{
+	ObjectManager::getInstance()->renderAheadThreadIDs.addIfNotAlreadyThere(getThreadId());
+
+	while (!threadShouldExit())
+	{
+		const uint32 gen = generation;
+		if (gen != checkedGeneration)
+		{
+			canRender = sequence->canRenderAhead();
+			checkedGeneration = gen;
+		}
+
+		const int rate = fps;
+		if (!canRender || rate <= 0 || !sequence->isPlaying->boolValue())
+		{
+			wait(10);
+			continue;
+		}
+
+		//first missing or incomplete frame from the current one, in the play direction
+		const int direction = sequence->playSpeed->floatValue() < 0 ? -1 : 1;
+		const int64 current = getFrameIndex(sequence->currentTime->floatValue());
+		int64 target = -1;
+		{
+			GenericScopedLock lock(bufferLock);
+			for (int i = 0; i < frames.size(); i++)
+			{
+				const int64 index = current + i * direction;
+				if (index < 0) break;
+
+				if (!isFrameComplete(frames[(int)(index % frames.size())], index, gen))
+				{
+					target = index;
+					break;
+				}
+			}
+		}
+
+		if (target < 0)
+		{
+			wait(jmax(1, 500 / rate));
+			continue;
+		}
+
+		Frame* f = renderFrame(target, gen);
+		if (f == nullptr) continue;
+
+		GenericScopedLock lock(bufferLock);
+		if (gen == generation && !frames.isEmpty()) frames.set((int)(target % frames.size()), f, true);
+		else delete f;
+	}
+
+	if (ObjectManager::getInstanceWithoutCreating() != nullptr) ObjectManager::getInstance()->renderAheadThreadIDs.removeFirstMatchingValue(getThreadId());
+}
+
+bool SequenceRenderAhead::isFrameComplete(const Frame* f, int64 index, uint32 gen) const
+{
+	if (f->index != index || f->generation != gen) return false;
+
+	for (auto& in : inputs)
+	{
+		if (!in->objectRef.wasObjectDeleted() && !f->hasOutput(in)) return false;
+	}
+
+	return true;
+}
+
+SequenceRenderAhead::Frame* SequenceRenderAhead::renderFrame(int64 index, uint32 gen)
+{
+	std::unique_ptr<Frame> f(new Frame());
+	f->index = index;
+	f->generation = gen;
+
+	//the inputs are copied so the compute thread can keep updating them,
+	//outputs of the buffered frame that are still up to date are kept instead of computed again
+	OwnedArray<Input> frameInputs;
+	{
+		GenericScopedLock lock(bufferLock);
+		if (frames.isEmpty()) return nullptr;
+
+		Frame* previous = frames[(int)(index % frames.size())];
+		const bool canReuse = previous->index == index && previous->generation == gen;
+
+		for (auto& in : inputs)
+		{
+			if (in->objectRef.wasObjectDeleted()) continue;
+
+			if (canReuse && previous->hasOutput(in))
+			{
+				HashMap<Parameter*, var>* values = new HashMap<Parameter*, var>();
+				HashMap<Parameter*, var>::Iterator it(*previous->outputMap[in->component]);
+				while (it.next()) values->set(it.getKey(), it.getValue().clone());
+				f->outputs.add(values);
+				f->outputMap.set(in->component, values);
+				f->inputVersions.set(in->component, in->version);
+				continue;
+			}
+
+			Input* fi = new Input();
+			fi->objectRef = in->objectRef;
+			fi->componentRef = in->componentRef;
+			fi->object = in->object;
+			fi->component = in->component;
+			fi->weightMultiplier = in->weightMultiplier;
+			fi->version = in->version;
+			HashMap<Parameter*, var>::Iterator it(in->values);
+			while (it.next()) fi->values.set(it.getKey(), it.getValue().clone());
+			frameInputs.add(fi);
+		}
+	}
+
+	if (frameInputs.isEmpty() && f->outputs.isEmpty()) return nullptr;
+
+	const float time = index / (float)fps;
+	ObjectManager* om = ObjectManager::getInstance();
+	for (auto& in : frameInputs)
+	{
+		if (threadShouldExit() || generation != gen) return nullptr;
+
+		HashMap<Parameter*, var>* values = new HashMap<Parameter*, var>();
+		values->swapWith(in->values);
+		f->outputs.add(values);
+
+		{
+			//objects are only removed with the items lock held, so they are checked and computed under it,
+			//in the same lock order as the compute thread (items, then process)
+			GenericScopedLock itemsLock(om->items.getLock());
+			if (in->objectRef == nullptr || in->componentRef == nullptr) continue;
+
+			GenericScopedLock lock(processLock);
+			sequence->processComponentAtTime(in->object, in->component, *values, in->weightMultiplier, time);
+		}
+
+		f->outputMap.set(in->component, values);
+		f->inputVersions.set(in->component, in->version);
+	}
+
+	return f.release();
+}
+
+void SequenceRenderAhead::controllableFeedbackUpdate(ControllableContainer* cc, Controllable* c)
+{
+	if (c->isControllableFeedbackOnly) return;
+	invalidate();
+}
+
+void SequenceRenderAhead::childStructureChanged(ControllableContainer* cc)
+{
+	invalidate();
+}
+
+void SequenceRenderAhead::newMessage(const SceneManagerEvent& e)
+{
+	invalidate();
+}
@@ -0,0 +1,87 @@
+/*
+  ==============================================================================
+
+    SequenceRenderAhead.h
+    Created: 18 Oct 2026 8:12:40pm
+    Author:  bkupe
+
+  ==============================================================================
+*/
+
+#pragma once
+
+class BluxSequence;
+class Object;
+class ObjectComponent;
+
+//Computes the output of a playing sequence a few frames ahead on its own thread, into a ring buffer of frames
+//on the tick grid of the engine clock. The compute thread uses the buffered frame for the current time when it was computed
+//from the same incoming values, and computes it live otherwise. Any change in the sequence (blocks, effects, layers)
+//or a scene load invalidates the buffered frames, different incoming values only invalidate the outputs of that component.
+class SequenceRenderAhead :
+    public Thread,
+    public ControllableContainerListener,
+    public AsyncSceneListener
+{
+public:
+    SequenceRenderAhead(BluxSequence* sequence);
+    ~SequenceRenderAhead();
+
+    BluxSequence* sequence;
+
+    //the layers keep scratch data while computing, so live and ahead computations of this sequence never overlap
+    CriticalSection processLock;
+
+    //values coming into the sequence for each component, as seen at the last compute tick
+    struct Input
+    {
+        WeakReference<ControllableContainer> objectRef;
+        WeakReference<ControllableContainer> componentRef;
+        Object* object = nullptr;
+        ObjectComponent* component = nullptr;
+        float weightMultiplier = 1;
+        uint32 version = 0; //incremented each time the values change
+        HashMap<Parameter*, var> values;
+    };
+
+    struct Frame
+    {
+        int64 index = -1;
+        uint32 generation = 0;
+        HashMap<ObjectComponent*, HashMap<Parameter*, var>*> outputMap;
+        HashMap<ObjectComponent*, uint32> inputVersions; //version of the input each output was computed from
+        OwnedArray<HashMap<Parameter*, var>> outputs;
+
+        bool hasOutput(const Input* in) const { return outputMap.contains(in->component) && inputVersions[in->component] == in->version; }
+    };
+
+    CriticalSection bufferLock;
+    OwnedArray<Input> inputs;
+    HashMap<ObjectComponent*, Input*> inputMap;
+    OwnedArray<Frame> frames; //ring buffer indexed by frame index modulo its size
+    std::atomic<uint32> generation;
+    std::atomic<int> fps;
+    int numFrames;
+
+    uint32 checkedGeneration;
+    std::atomic<bool> canRender;
+
+    void start(int numFramesAhead);
+    void stop();
+    void invalidate();
+
+    int64 getFrameIndex(float time) const;
+
+    //compute thread
+    void processComponent(Object* o, ObjectComponent* c, HashMap<Parameter*, var>& values, float weightMultiplier);
+    bool updateInput(Object* o, ObjectComponent* c, const HashMap<Parameter*, var>& values, float weightMultiplier);
+
+    //render-ahead thread
+    void run() override;
+    bool isFrameComplete(const Frame* f, int64 index, uint32 gen) const;
+    Frame* renderFrame(int64 index, uint32 gen);
+
+    void controllableFeedbackUpdate(ControllableContainer* cc, Controllable* c) override;
+    void childStructureChanged(ControllableContainer* cc) override;
+    void newMessage(const SceneManagerEvent& e) override;
+};
@@ -14,7 +14,9 @@
 juce_ImplementSingleton(EffectBlockFactory)
 
 EffectBlockManager::EffectBlockManager(EffectLayer * layer) :
-    LayerBlockManager(layer, "Blocks")
+    LayerBlockManager(layer, "Blocks"),
+	effectLayer(layer),
+	intervalsDirty(true)
 {
     managerFactory = EffectBlockFactory::getInstance();
 }
@@ -23,6 +25,69 @@ EffectBlockManager::~EffectBlockManager()
 {
 }
 
+void EffectBlockManager::invalidateIntervals()
+{
+	intervalsDirty = true;
+}
+
+void EffectBlockManager::rebuildIntervals()
+{
+	intervalsDirty = false;
+
+	intervals.clearQuick();
+	for (auto& b : items)
+	{
+		float start = b->time->floatValue();
+		intervals.add({ start, start + b->getTotalLength(), 0, (EffectBlock*)b });
+	}
+
+	struct StartComparator
+	{
+		static int compareElements(const BlockInterval& a, const BlockInterval& b) { return a.start < b.start ? -1 : (a.start > b.start ? 1 : 0); }
+	};
+
+	StartComparator comparator;
+	intervals.sort(comparator, true);
+
+	float maxEnd = std::numeric_limits<float>::lowest();
+	for (auto& i : intervals)
+	{
+		maxEnd = jmax(maxEnd, i.end);
+		i.maxEnd = maxEnd;
+	}
+}
+
+void EffectBlockManager::getEffectBlocksAtTime(float time, Array<EffectBlock*>& result, bool includeDisabled)
+{
+	SpinLock::ScopedLockType lock(intervalLock);
+	if (intervalsDirty) rebuildIntervals();
+
+	//find the last interval starting before time, then walk back until no earlier block can still be running
+	int low = 0;
+	int high = intervals.size();
+	while (low < high)
+	{
+		int mid = (low + high) / 2;
+		if (intervals.getReference(mid).start <= time) low = mid + 1;
+		else high = mid;
+	}
+	int firstResult = result.size();
+	for (int i = low - 1; i >= 0; i--)
+	{
+		const BlockInterval& bi = intervals.getReference(i);
+		if (bi.maxEnd < time) break;
+		if (bi.end < time) continue;
+		if (!includeDisabled && !bi.block->enabled->boolValue()) continue;
+		result.insert(firstResult, bi.block); //keep start order
+	}
+}
+
+void EffectBlockManager::setupBakePool(EffectBlock* block)
+{
+	if (block->effect == nullptr) return;
+	if (BluxSequence* s = dynamic_cast<BluxSequence*>(effectLayer->sequence)) block->effect->effectParams.setBakePool(s->bakePool.get());
+}
+
 LayerBlock * EffectBlockManager::createItem()
 {
     return new EffectBlock();
@@ -33,6 +98,8 @@ void EffectBlockManager::addItemInternal(LayerBlock* block, var data)
 	LayerBlockManager::addItemInternal(block, data);
 	EffectBlock * clip = dynamic_cast<EffectBlock *>(block);
 	clip->addEffectBlockListener(this);
+	setupBakePool(clip);
+	invalidateIntervals();
 }
 
 void EffectBlockManager::addItemsInternal(Array<LayerBlock*> blocks, var data)
@@ -42,7 +109,9 @@ void EffectBlockManager::addItemsInternal(Array<LayerBlock*> blocks, var data)
 	{
 		EffectBlock * clip = dynamic_cast<EffectBlock *>(b);
 		clip->addEffectBlockListener(this);
+		setupBakePool(clip);
 	}
+	invalidateIntervals();
 }
 
 void EffectBlockManager::removeItemInternal(LayerBlock* block)
@@ -50,6 +119,7 @@ void EffectBlockManager::removeItemInternal(LayerBlock* block)
 	LayerBlockManager::removeItemInternal(block);
 	EffectBlock * clip = dynamic_cast<EffectBlock *>(block);
 	clip->removeEffectBlockListener(this);
+	invalidateIntervals();
 }
 
 void EffectBlockManager::removeItemsInternal(Array<LayerBlock*> blocks)
@@ -60,6 +130,7 @@ void EffectBlockManager::removeItemsInternal(Array<LayerBlock*> blocks)
 		EffectBlock * clip = dynamic_cast<EffectBlock *>(b);
 		clip->removeEffectBlockListener(this);
 	}
+	invalidateIntervals();
 }
 
 void EffectBlockManager::onControllableFeedbackUpdate(ControllableContainer* cc, Controllable* c)
@@ -69,6 +140,7 @@ void EffectBlockManager::onControllableFeedbackUpdate(ControllableContainer* cc,
 	{
 		if (c == b->time || c == b->coreLength || c == b->loopLength)
 		{
+			invalidateIntervals();
 			if (!blocksCanOverlap) return;
 			computeFadesForBlock(b, true);
 		}
@@ -30,6 +30,25 @@ public:
 
     EffectLayer* effectLayer;
 
+    //Interval index over the blocks : sorted by start time, with the running max of end times to stop the backward scan early
+    struct BlockInterval
+    {
+        float start;
+        float end;
+        float maxEnd;
+        EffectBlock* block;
+    };
+
+    SpinLock intervalLock;
+    Array<BlockInterval> intervals;
+    bool intervalsDirty;
+
+    void invalidateIntervals();
+    void rebuildIntervals();
+    void getEffectBlocksAtTime(float time, Array<EffectBlock*>& result, bool includeDisabled = true);
+
+    void setupBakePool(EffectBlock* block);
+
     LayerBlock * createItem() override;
 
     void addItemInternal(LayerBlock* clip, var) override;
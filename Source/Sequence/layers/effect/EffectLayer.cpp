@@ -14,7 +14,9 @@
 
 EffectLayer::EffectLayer(Sequence* s, var params) :
 	SequenceLayer(s, "Effect"),
-	blockManager(this)
+	blockManager(this),
+	queryTick(0),
+	numTimeQueries(0)
 {
 	saveAndLoadRecursiveData = true;
 
@@ -31,6 +33,39 @@ EffectLayer::~EffectLayer()
 {
 }
 
+const Array<EffectBlock*>& EffectLayer::getBlocksAtTime(float time)
+{
+	ObjectManager* om = ObjectManager::getInstance();
+	if (!om->isComputeThread())
+	{
+		tmpBlocks.clearQuick();
+		blockManager.getEffectBlocksAtTime(time, tmpBlocks, false);
+		return tmpBlocks;
+	}
+
+	if (queryTick != om->computeTick)
+	{
+		queryTick = om->computeTick;
+		numTimeQueries = 0;
+		timeQueryIndices.clear();
+	}
+
+	int timeKey;
+	memcpy(&timeKey, &time, sizeof(float));
+	if (timeQueryIndices.contains(timeKey)) return timeQueries[timeQueryIndices[timeKey]]->blocks;
+
+	if (numTimeQueries >= timeQueries.size()) timeQueries.add(new TimeQuery());
+	TimeQuery* q = timeQueries[numTimeQueries];
+	q->time = time;
+	q->blocks.clearQuick();
+	blockManager.getEffectBlocksAtTime(time, q->blocks, false);
+
+	timeQueryIndices.set(timeKey, numTimeQueries);
+	numTimeQueries++;
+
+	return q->blocks;
+}
+
 Array<ChainVizTarget*> EffectLayer::getChainVizTargetsForObjectAndComponent(Object* o, ComponentType c)
 {
 	Array<ChainVizTarget*> result;
@@ -41,47 +76,51 @@ Array<ChainVizTarget*> EffectLayer::getChainVizTargetsForObjectAndComponent(Obje
 	int id = fr.id == -1 ? o->globalID->intValue() : fr.id;
 
 	float time = sequence->currentTime->floatValue() - timeOffsetByID->floatValue() * id;
-	Array<LayerBlock*> blocks = blockManager.getBlocksAtTime(time);
+	Array<EffectBlock*> blocks;
+	blockManager.getEffectBlocksAtTime(time, blocks);
 
-	for (auto& i : blocks)
+	for (auto& eb : blocks)
 	{
-		EffectBlock* eb = (EffectBlock*)i;
 		if (eb->effect->isAffectingObjectAndComponent(o, c)) result.add(eb->effect.get());
 	}
 
 	return result;
 }
 
-void EffectLayer::processComponent(Object* o, ObjectComponent* c, HashMap<Parameter*, var>& values, float weightMultiplier)
+void EffectLayer::processComponent(Object* o, ObjectComponent* c, HashMap<Parameter*, var>& values, float weightMultiplier, float sequenceTime)
 {
 	FilterResult fr = filterManager->getFilteredResultForComponent(o, c);
 	if (fr.id == -1) return;
 
-	float time = sequence->currentTime->floatValue() - timeOffsetByID->floatValue() * fr.id;
-	Array<LayerBlock*> blocks = blockManager.getBlocksAtTime(time, false);
+	float time = sequenceTime - timeOffsetByID->floatValue() * fr.id;
+	const Array<EffectBlock*>& blocks = getBlocksAtTime(time);
 
 	if (blocks.isEmpty()) return;
 
 	if (blocks.size() == 1) {
-		EffectBlock* eb = (EffectBlock*)blocks[0];
-		eb->processComponent(o, c, values, fr.weight * weightMultiplier, fr.id, time);
+		blocks[0]->processComponent(o, c, values, fr.weight * weightMultiplier, fr.id, time);
 		return;
 	}
 
 	//lerp
 	HashMap<Parameter*, var>::Iterator valIt(values);
 
-	OwnedArray<HashMap<Parameter*, var>> blockMaps;
-	Array<float> blockWeights;
+	const int numBlocks = blocks.size();
+	while (blendMaps.size() < numBlocks) blendMaps.add(new HashMap<Parameter*, var>());
+	blendWeights.clearQuick();
+	float totalWeight = 0;
 
-	for (auto& b : blocks)
+	for (int i = 0; i < numBlocks; i++)
 	{
-		HashMap<Parameter*, var>* bVals = new HashMap<Parameter*, var>();
+		HashMap<Parameter*, var>* bVals = blendMaps[i];
+		bVals->clear();
 		valIt.reset();
 		while (valIt.next()) bVals->set(valIt.getKey(), valIt.getValue().clone());
-		((EffectBlock*)b)->processComponent(o, c, *bVals, fr.weight * weightMultiplier, fr.id, time, true);
-		blockMaps.add(bVals);
-		blockWeights.add(((EffectBlock*)b)->getFadeMultiplier(time));
+		blocks[i]->processComponent(o, c, *bVals, fr.weight * weightMultiplier, fr.id, time, true);
+
+		float w = blocks[i]->getFadeMultiplier(time);
+		blendWeights.add(w);
+		totalWeight += w;
 	}
 
 
@@ -91,63 +130,62 @@ void EffectLayer::processComponent(Object* o, ObjectComponent* c, HashMap<Parame
 	while (valIt.next())
 	{
 		Parameter* cp = valIt.getKey();
-		Array<var> blockVals;
+		const var& firstVal = blendMaps.getFirst()->getReference(cp);
+
 		bool sameVal = true;
-		var firstVal = blockMaps.getFirst()->getReference(cp);
-		for (auto& b : blockMaps)
+		for (int i = 1; i < numBlocks && sameVal; i++)
 		{
-			var v = b->getReference(cp);
-			jassert(v.size() == firstVal.size());
-			if (v != firstVal) sameVal = false;
-			blockVals.add(v);
+			jassert(blendMaps[i]->getReference(cp).size() == firstVal.size());
+			sameVal = blendMaps[i]->getReference(cp) == firstVal;
 		}
 
 		if (sameVal)
 		{
-			DBG("Same val, not lerping");
 			values.set(cp, firstVal);
 			continue;
 		}
 
-		DBG("Different values, lerping");
-
-		var averageVal = getAverageValue(blockVals, blockWeights);
-		values.set(cp, averageVal);
+		values.set(cp, getAverageValue(cp, numBlocks, totalWeight));
 	}
-
-	//for (auto& b : blocks) ((EffectBlock*)b)->processComponent(o, c, values, fr.weight * weightMultiplier, fr.id, time);
 }
 
-var EffectLayer::getAverageValue(Array<var> values, Array<float> weights)
+var EffectLayer::getAverageValue(Parameter* cp, int numBlocks, float totalWeight)
 {
-	if (values.isEmpty()) return 0;
-
-	bool valuesAreArrays = values[0].isArray();
+	//values are either floats, arrays of floats (colors, points) or arrays of arrays (pixel colors)
+	const var& firstVal = blendMaps.getFirst()->getReference(cp);
+	const float* weights = blendWeights.getRawDataPointer();
 
-	if (!valuesAreArrays)
+	if (!firstVal.isArray())
 	{
-		float totalValue = 0;
-		float totalWeight = 0;
-		for (int i = 0; i < values.size(); i++)
-		{
-			totalValue += (float)values[i] * weights[i];
-			totalWeight += weights[i];
-		}
-
 		if (totalWeight == 0) return 0;
+
+		float totalValue = 0;
+		for (int i = 0; i < numBlocks; i++) totalValue += (float)blendMaps[i]->getReference(cp) * weights[i];
 		return totalValue / totalWeight;
 	}
 
-	//values are arrays
-	//recurse
-
 	var result;
-	for (int vi = 0; vi < values[0].size(); vi++)
+	const int size = firstVal.size();
+	for (int vi = 0; vi < size; vi++)
 	{
-		Array<var> subValues;
-		for (int i = 0; i < values.size(); i++) subValues.add(values[i][vi]);
-		var v = getAverageValue(subValues, weights);
-		result.append(v);
+		const var& firstSub = firstVal[vi];
+		if (!firstSub.isArray())
+		{
+			float totalValue = 0;
+			for (int i = 0; i < numBlocks; i++) totalValue += (float)blendMaps[i]->getReference(cp)[vi] * weights[i];
+			result.append(totalWeight == 0 ? 0 : totalValue / totalWeight);
+			continue;
+		}
+
+		var subResult;
+		const int subSize = firstSub.size();
+		for (int si = 0; si < subSize; si++)
+		{
+			float totalValue = 0;
+			for (int i = 0; i < numBlocks; i++) totalValue += (float)blendMaps[i]->getReference(cp)[vi][si] * weights[i];
+			subResult.append(totalWeight == 0 ? 0 : totalValue / totalWeight);
+		}
+		result.append(subResult);
 	}
 
 	return result;
@@ -28,10 +28,28 @@ public:
 
 	Array<EffectBlock*, CriticalSection> activeBlocks;
 
+	//block lookups done during a compute tick, shared between all objects that have the same offset time
+	struct TimeQuery
+	{
+		float time;
+		Array<EffectBlock*> blocks;
+	};
+	uint32 queryTick;
+	OwnedArray<TimeQuery> timeQueries;
+	int numTimeQueries;
+	HashMap<int, int> timeQueryIndices;
+
+	//scratch buffers reused when blending overlapping blocks
+	OwnedArray<HashMap<Parameter*, var>> blendMaps;
+	Array<float> blendWeights;
+	Array<EffectBlock*> tmpBlocks;
+
+	const Array<EffectBlock*>& getBlocksAtTime(float time);
+
 	Array<ChainVizTarget*> getChainVizTargetsForObjectAndComponent(Object* o, ComponentType t);
-	virtual void processComponent(Object* o, ObjectComponent* c, HashMap<Parameter*, var>& values, float weightMultiplier = 1.0f);
+	virtual void processComponent(Object* o, ObjectComponent* c, HashMap<Parameter*, var>& values, float weightMultiplier, float sequenceTime);
 
-	var getAverageValue(Array<var> values, Array<float> weights);
+	var getAverageValue(Parameter* cp, int numBlocks, float totalWeight);
 
 	SequenceLayerTimeline* getTimelineUI() override;
 
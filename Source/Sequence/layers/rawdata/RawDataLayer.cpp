@@ -18,7 +18,8 @@ RawDataLayer::RawDataLayer(Sequence* s, var params) :
 	numWrittenFrames(0),
 	activeBlock(nullptr),
 	needsToSendAllUniverses(true),
-	dmxInterface(nullptr)
+	dmxInterface(nullptr),
+	renderCC("Offline Render")
 {
 	saveAndLoadRecursiveData = true;
 	addChildControllableContainer(&blockManager);
@@ -40,11 +41,28 @@ RawDataLayer::RawDataLayer(Sequence* s, var params) :
 	isRecording = addBoolParameter("Is Recording", "", false);
 	isRecording->setControllableFeedbackOnly(true);
 
-
+	renderScene = renderCC.addTargetParameter("Scene", "If set, this scene is loaded at the beginning of the render", SceneManager::getInstance());
+	renderScene->targetType = TargetParameter::CONTAINER;
+	renderScene->maxDefaultSearchLevel = 0;
+	renderSceneLoadTime = renderCC.addFloatParameter("Scene Load Time", "If enabled, the scene is loaded with this time instead of its default load time", 1, 0);
+	renderSceneLoadTime->defaultUI = FloatParameter::TIME;
+	renderSceneLoadTime->canBeDisabledByUser = true;
+	renderSceneLoadTime->setEnabled(false);
+	renderStart = renderCC.addFloatParameter("Start Time", "Sequence time at which the render starts", 0, 0);
+	renderStart->defaultUI = FloatParameter::TIME;
+	renderLength = renderCC.addFloatParameter("Length", "Duration of the render", 10, .1f);
+	renderLength->defaultUI = FloatParameter::TIME;
+	renderFPS = renderCC.addIntParameter("FPS", "Frames rendered per second of sequence time", 50, 1, 200);
+	renderFile = renderCC.addFileParameter("File", "The rawdata file to render to");
+	renderFile->setValue("records/render.rawdata");
+	renderFile->saveMode = true;
+	renderTrigger = renderCC.addTrigger("Render", "Render the target interface output over the time range, faster than real time, and add it as a block in this layer");
+	addChildControllableContainer(&renderCC);
 }
 
 RawDataLayer::~RawDataLayer()
 {
+	renderer.reset();
 	setDMXInterface(nullptr);
 }
 
@@ -57,6 +75,12 @@ void RawDataLayer::onContainerParameterChangedInternal(Parameter* p)
 	}
 }
 
+void RawDataLayer::onControllableFeedbackUpdateInternal(ControllableContainer* cc, Controllable* c)
+{
+	SequenceLayer::onControllableFeedbackUpdateInternal(cc, c);
+	if (c == renderTrigger) startOfflineRender();
+}
+
 void RawDataLayer::setDMXInterface(DMXInterface* in)
 {
 	if (in == dmxInterface) return;
@@ -165,6 +189,57 @@ void RawDataLayer::stopRecording()
 	blockManager.addItem(b);
 }
 
+void RawDataLayer::startOfflineRender()
+{
+	if (dmxInterface == nullptr)
+	{
+		NLOGWARNING(niceName, "Offline render needs a target DMX interface");
+		return;
+	}
+
+	if (isRecording->boolValue() || (renderer != nullptr && renderer->isThreadRunning())) return;
+
+	OfflineRenderer::Settings s;
+	s.dmxInterface = dmxInterface;
+	s.sequence = sequence;
+	s.scene = dynamic_cast<Scene*>(renderScene->targetContainer.get());
+	s.sceneLoadTime = renderSceneLoadTime->enabled ? renderSceneLoadTime->floatValue() : -1;
+	s.startTime = renderStart->floatValue();
+	s.duration = renderLength->floatValue();
+	s.fps = renderFPS->intValue();
+	s.file = renderFile->getFile();
+
+	isRecording->setValue(true); //blocks of this layer are not played back into the render
+
+	WeakReference<ControllableContainer> layerRef(this);
+	renderer.reset(new OfflineRenderer());
+	renderer->onFinished = [layerRef](OfflineRenderer* r)
+	{
+		bool success = r->success;
+		MessageManager::callAsync([layerRef, success]()
+			{
+				if (layerRef.wasObjectDeleted()) return;
+				((RawDataLayer*)layerRef.get())->offlineRenderFinished(success);
+			});
+	};
+	renderer->start(s);
+}
+
+void RawDataLayer::offlineRenderFinished(bool success)
+{
+	isRecording->setValue(false);
+
+	File f = renderer->settings.file;
+	float time = renderer->settings.startTime;
+	renderer.reset();
+
+	if (!success) return;
+
+	RawDataBlock* b = new RawDataBlock();
+	b->time->setValue(time);
+	b->fileParam->setValue(f.getFullPathName());
+	blockManager.addItem(b);
+}
 
 void RawDataLayer::sequencePlayStateChanged(Sequence* s)
 {
@@ -10,6 +10,8 @@
 
 #pragma once
 
+class OfflineRenderer;
+
 class RawDataLayer :
 	public SequenceLayer,
 	public DMXInterface::DMXInterfaceListener
@@ -47,7 +49,20 @@ public:
 
 	OwnedArray<DMXUniverse, CriticalSection> frameUniverses; //the one that will be copied to interface
 
+	//Offline render of the sequence (and optionally a scene load) into a recording, faster than real time
+	ControllableContainer renderCC;
+	TargetParameter* renderScene;
+	FloatParameter* renderSceneLoadTime;
+	FloatParameter* renderStart;
+	FloatParameter* renderLength;
+	IntParameter* renderFPS;
+	FileParameter* renderFile;
+	Trigger* renderTrigger;
+
+	std::unique_ptr<OfflineRenderer> renderer;
+
 	void onContainerParameterChangedInternal(Parameter* p) override;
+	void onControllableFeedbackUpdateInternal(ControllableContainer* cc, Controllable* c) override;
 
 	void setDMXInterface(DMXInterface* in);
 
@@ -55,6 +70,9 @@ public:
 	void recordOneFrame();
 	void stopRecording();
 
+	void startOfflineRender();
+	void offlineRenderFinished(bool success);
+
 	virtual void sequencePlayStateChanged(Sequence*) override;
 	virtual void sequenceCurrentTimeChanged(Sequence*, float prevTime, bool /*evaluateSkippedData*/) override;
 